@@ -0,0 +1,38 @@
+/****************************************************************************
+** 
+** Copyright 2010 Alexander Krosch
+** 
+** This file is part of QPG - the Q Parser Generator.
+** 
+** QPG is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+** 
+** QPG is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with QPG.  If not, see <http://www.gnu.org/licenses/>.
+** 
+****************************************************************************/
+#ifndef CHARCLASSES_H
+#define CHARCLASSES_H
+
+#include <QtGlobal>
+
+//ranges of the predefined regular expression classes, indexed by REParser::CharClass;
+//CharClasses.cpp is generated from UnicodeData.txt with qpg -b4 UnicodeData.txt
+class CharClasses {
+	public:
+		struct Range {
+			uint from;//inclusive
+			uint to;//exclusive
+		};
+		static const Range * const ranges[6];
+		static const int sizes[6];
+};
+
+#endif
@@ -25,6 +25,7 @@
 #include <QFile>
 #include <QBuffer>
 #include <QRegExp>
+#include <QTime>
 #include "utils.h"
 #include "pda.h"
 #include "Recorder.h"
@@ -150,12 +151,54 @@ void Parser::setOption(const QString & option, const QString & value, int line)
 		} else if(option=="tokenInfo") {
 			options[OptionInfoFunc]=value;
 			return;
+		} else if(option=="Encoding" && (value=="utf16" || value=="utf8" || value=="latin1")) {
+			options[OptionEncoding]=value;
+			reparser.setEncoding(value=="utf8"?REParser::Utf8:REParser::Utf16);
+			reparser.clear();
+			return;
+		} else if(option=="Input" && (value=="character" || value=="buffer")) {
+			options[OptionInput]=value;
+			return;
+		} else if(option=="refill") {
+			options[OptionRefill]=value;
+			return;
+		} else if(option=="TokenView") {
+			options[OptionTokenView]=value;
+			return;
+		} else if(option=="parseFile") {
+			options[OptionParseFile]=value;
+			return;
+		} else if(option=="parseStream") {
+			options[OptionParseStream]=value;
+			return;
+		} else if(option=="NodeAllocator") {
+			options[OptionNodeAllocator]=value;
+			return;
+		} else if(option=="ParserTables" && (value=="packed" || value=="dense")) {
+			options[OptionParserTables]=value;
+			return;
+		} else if(option=="LexerStyle" && (value=="table" || value=="direct")) {
+			options[OptionLexerStyle]=value;
+			return;
+		} else if(option=="ParserStyle" && (value=="table" || value=="direct")) {
+			options[OptionParserStyle]=value;
+			return;
+		} else if(option=="LookAheads" && (value=="lalr" || value=="legacy")) {
+			options[OptionLookAheads]=value;
+			return;
+		} else if((option=="BufferSize" || option=="MaxTokenLength") && value.toInt()>0) {
+			options[option=="BufferSize"?OptionBufferSize:OptionMaxTokenLength]=QString::number(value.toInt());
+			return;
 		}
 	}
 	
 	error(line, QString("Option '%1' does not exist or value (%2) not compatible").arg(option).arg(value));
 }
 
+void Parser::setOption(const QString & option, int value, int line) {
+	setOption(option, QString::number(value), line);
+}
+
 void Parser::define(const QString & id, const QString & regexp, int line_id, int line_re) {
 	if(reparser.isDefined(id)) {
 		error(line_id, QString("'%1' is already used as the name for a regular expression.").arg(id));
@@ -448,6 +491,19 @@ void Parser::resetOptions() {
 	options[OptionInfoType]="";
 	options[OptionInfoFunc]="tokenInfo";
 	options[OptionLR1]="";
+	options[OptionEncoding]="utf16";
+	options[OptionInput]="character";
+	options[OptionRefill]="refill";
+	options[OptionTokenView]="TokenView";
+	options[OptionParseFile]="";
+	options[OptionParseStream]="";
+	options[OptionBufferSize]="65536";
+	options[OptionMaxTokenLength]="";
+	options[OptionNodeAllocator]="";
+	options[OptionParserTables]="dense";
+	options[OptionLexerStyle]="table";
+	options[OptionParserStyle]="table";
+	options[OptionLookAheads]="lalr";
 }
 
 
@@ -461,6 +517,7 @@ bool Parser::parseFile(const QString & s) {
 	errmsg="";
 	line1=1;
 	line2=1;
+	reparser.setEncoding(REParser::Utf16);
 	reparser.clear();
 	patterns.clear();
 	anonPatterns.clear();
@@ -488,11 +545,13 @@ bool Parser::compileTokens(const QMap<QString, int> & startConditions) {
 	const QString & opt_class=options[OptionClass];
 	const QString & opt_tokenList=options[OptionTokenList];
 	const QString & opt_info_type=options[OptionInfoType];
+	const QString & opt_node_allocator=options[OptionNodeAllocator];
 	const int n(cfg.terminalCount());
 	hstream<<
 		"class "<<opt_class<<"::"<<opt_tokenList<<" {\n"
 		"\tpublic:\n"
-		"\t\tstruct Node;\n";
+		"\t\tstruct Node;\n"
+		"\t\tclass Allocator;\n";
 	if(startConditions.size()>1) {
 		hstream<<"\t\tenum SC {\n\t\t\t";
 		for(QMap<QString, int>::const_iterator it(startConditions.begin()); it!=startConditions.end(); ++it) {
@@ -504,13 +563,14 @@ bool Parser::compileTokens(const QMap<QString, int> & startConditions) {
 	hstream<<
 		"\tprotected:\n"
 		//"\t\t"<<opt_class<<" *_parser;\n"
+		"\t\tAllocator *allocator;\n"
 		"\t\tNode *firstNode;\n"
 		"\t\tNode *lastNode;\n";
 	if(startConditions.size()>1)hstream<<"\t\tSC cursc;\n";
 	hstream<<
 		"\tpublic:\n"
 		//"\t\t"<<opt_tokenList<<"("<<opt_class<<" *_p"<<");\n"//_parser
-		"\t\t"<<opt_tokenList<<"();\n"
+		"\t\t"<<opt_tokenList<<"(Allocator *a=0);\n"
 		"\t\t~"<<opt_tokenList<<"();\n"
 		"\t\tvoid eof();\n";
 	for(int i=0; i<n; i++) {
@@ -528,6 +588,12 @@ bool Parser::compileTokens(const QMap<QString, int> & startConditions) {
 		}
 		if(opt_info_type.length())hstream<<", const "<<opt_class<<"::"<<opt_info_type<<" & meta";
 		hstream<<");\n";
+		if(t.length() && !t.endsWith("*")) {
+			hstream<<
+				"#ifdef Q_COMPILER_RVALUE_REFS\n"
+				"\t\tvoid append"<<sym<<"("<<t<<" && val"<<(opt_info_type.length()?QString(", const %1::%2 & meta").arg(opt_class).arg(opt_info_type):QString(""))<<");\n"
+				"#endif\n";
+		}
 	}
 	if(startConditions.size()>1) {
 		hstream<<
@@ -546,21 +612,91 @@ bool Parser::compileTokens(const QMap<QString, int> & startConditions) {
 	ostream<<
 		"\tNode():ref(0), mark(0) {}\n"
 		"\tNode(int m"<<(opt_info_type.length()?QString(", const %1::%2 & i").arg(opt_class).arg(opt_info_type):QString(""))<<"):ref(0), mark(m)"<<(opt_info_type.length()?", info(i)":"")<<" {}\n"
-		"\t~Node() {if(ref)delete ref;}\n"
-		"\tvirtual void foo() {}\n"
+		"\tstatic void *operator new(size_t size, "<<opt_tokenList<<"::Allocator *allocator);\n"
+		"\tstatic void operator delete(void *p, "<<opt_tokenList<<"::Allocator *allocator);\n"
 		"};\n"
-		"\n"
+		"\n";
+	//every parse has an allocator of its own, the nodes of a token list are
+	//allocated and released by the allocator of the list
+	if(opt_node_allocator.length()) {
+		ostream<<
+			"class "<<opt_class<<"::"<<opt_tokenList<<"::Allocator : public "<<opt_class<<"::"<<opt_node_allocator<<" {\n"
+			"};\n"
+			"\n";
+	} else {
+		//free lists per size class, carved from chunks that are all released
+		//together at the end of the parse; the classes step by the size of a
+		//union of the most aligned types, so every node keeps its alignment
+		ostream<<
+			"class "<<opt_class<<"::"<<opt_tokenList<<"::Allocator {\n"
+			"\tprivate:\n"
+			"\t\tunion Align {long double d; long long l; void *p; void (*f)();};\n"
+			"\t\tenum {ChunkSize=16384, Classes=32, Step=sizeof(Align)};\n"
+			"\t\tvoid *freeLists[Classes];\n"
+			"\t\tQList<char *> chunks;\n"
+			"\t\tchar *top;\n"
+			"\t\tchar *limit;\n"
+			"\t\tAllocator(const Allocator &);\n"
+			"\t\tAllocator & operator=(const Allocator &);\n"
+			"\tpublic:\n"
+			"\t\tAllocator():top(0), limit(0) {\n"
+			"\t\t\tfor(int i=0; i<Classes; i++)freeLists[i]=0;\n"
+			"\t\t}\n"
+			"\t\t~Allocator() {\n"
+			"\t\t\tforeach(char *chunk, chunks)::operator delete(chunk);\n"
+			"\t\t}\n"
+			"\t\tvoid *allocate(size_t size) {\n"
+			"\t\t\tconst size_t c((size+Step-1)/Step);\n"
+			"\t\t\tif(c>=Classes)return ::operator new(size);\n"
+			"\t\t\tvoid *res(freeLists[c]);\n"
+			"\t\t\tif(res) {\n"
+			"\t\t\t\tfreeLists[c]=*(void **)res;\n"
+			"\t\t\t\treturn res;\n"
+			"\t\t\t}\n"
+			"\t\t\tif(size_t(limit-top)<c*Step) {\n"
+			"\t\t\t\ttop=(char *)::operator new(ChunkSize);\n"
+			"\t\t\t\tlimit=top+ChunkSize;\n"
+			"\t\t\t\tchunks.append(top);\n"
+			"\t\t\t}\n"
+			"\t\t\tres=top;\n"
+			"\t\t\ttop+=c*Step;\n"
+			"\t\t\treturn res;\n"
+			"\t\t}\n"
+			"\t\tvoid release(void *p, size_t size) {\n"
+			"\t\t\tconst size_t c((size+Step-1)/Step);\n"
+			"\t\t\tif(c>=Classes) {\n"
+			"\t\t\t\t::operator delete(p);\n"
+			"\t\t\t\treturn;\n"
+			"\t\t\t}\n"
+			"\t\t\t*(void **)p=freeLists[c];\n"
+			"\t\t\tfreeLists[c]=p;\n"
+			"\t\t}\n"
+			"};\n"
+			"\n";
+	}
+	ostream<<
 		"namespace {\n"
 		"\ttemplate<typename T>\n"
 		"\tstruct NodeImpl : public "<<opt_class<<"::"<<opt_tokenList<<"::Node {\n"
 		"\t\tT value;\n"
 		"\t\tNodeImpl(int m"<<(opt_info_type.length()?QString(", const %1::%2 & i").arg(opt_class).arg(opt_info_type):QString(""))<<", const T & v=T()):Node(m"<<(opt_info_type.length()?", i":"")<<"), value(v) {}\n"
+		"#ifdef Q_COMPILER_RVALUE_REFS\n"
+		"\t\tNodeImpl(int m"<<(opt_info_type.length()?QString(", const %1::%2 & i").arg(opt_class).arg(opt_info_type):QString(""))<<", T && v):Node(m"<<(opt_info_type.length()?", i":"")<<"), value(static_cast<T &&>(v)) {}\n"
+		"#endif\n"
 		"\t};\n"
 		"\t\n"
+		"#ifdef Q_COMPILER_RVALUE_REFS\n"
+		"\ttemplate<typename T>\n"
+		"\tT && takeValue(T & value) {return static_cast<T &&>(value);}\n"
+		"#else\n"
+		"\ttemplate<typename T>\n"
+		"\tT & takeValue(T & value) {return value;}\n"
+		"#endif\n"
+		"\t\n"
 		"\tclass "<<opt_tokenList<<"Impl : public "<<opt_class<<"::"<<opt_tokenList<<" {\n"
 		"\t\tpublic:\n"
 		//"\t\t\t"<<opt_tokenList<<"Impl("<<opt_class<<" *_p=0):"<<opt_tokenList<<"(_p) {}\n"//_parser
-		"\t\t\t"<<opt_tokenList<<"Impl() {}\n"
+		"\t\t\t"<<opt_tokenList<<"Impl(Allocator *a):"<<opt_tokenList<<"(a) {}\n"
 		"\t\t\tvoid append(Node *node);\n"
 		"\t\t\tvoid prepend(Node *node);\n"
 		"\t\t\tNode *first()const;\n"
@@ -604,19 +740,69 @@ bool Parser::compileTokens(const QMap<QString, int> & startConditions) {
 		"\tbool "<<opt_tokenList<<"Impl::isEmpty()const {\n"
 		"\t\treturn !firstNode;\n"
 		"\t}\n"
+		"\t\n";
+	//nodes have no vtable, the mark of a node tells the type of its value
+	QMap<QString, QList<int> > marksByType;
+	for(int i=0; i<n; i++) {
+		const QString t(symtypes.value(CFG::Symbol(i, true)));
+		if(t!="" && t!="void")marksByType[t].append(i);
+	}
+	for(int i=0; i<cfg.nonterminalCount(); i++) {
+		const QString t(symtypes.value(CFG::Symbol(i, false)));
+		if(t!="" && t!="void")marksByType[t].append(i+n+1);
+	}
+	//a whole list is freed in one loop, long lists must not exhaust the call stack
+	ostream<<
+		"\ttemplate<typename N>\n"
+		"\tvoid destroyNode("<<opt_class<<"::"<<opt_tokenList<<"::Allocator *allocator, N *node) {\n"
+		"\t\tnode->~N();\n"
+		"\t\tif(allocator) {\n"
+		"\t\t\tallocator->release(node, sizeof(N));\n"
+		"\t\t} else {\n"
+		"\t\t\t::operator delete(node);\n"
+		"\t\t}\n"
+		"\t}\n"
+		"\t\n"
+		"\tvoid deleteNode("<<opt_class<<"::"<<opt_tokenList<<"::Allocator *allocator, "<<opt_class<<"::"<<opt_tokenList<<"::Node *node) {\n"
+		"\t\twhile(node) {\n"
+		"\t\t\t"<<opt_class<<"::"<<opt_tokenList<<"::Node *next(node->ref);\n"
+		"\t\t\tswitch(node->mark) {\n";
+	for(QMap<QString, QList<int> >::const_iterator it(marksByType.begin()); it!=marksByType.end(); ++it) {
+		foreach(int mark, it.value())ostream<<"\t\t\t\tcase "<<mark<<":\n";
+		ostream<<
+			"\t\t\t\t\tdestroyNode(allocator, (NodeImpl<"<<it.key()<<" > *)node);\n"
+			"\t\t\t\t\tbreak;\n";
+	}
+	ostream<<
+		"\t\t\t\tdefault:\n"
+		"\t\t\t\t\tdestroyNode(allocator, node);\n"
+		"\t\t\t}\n"
+		"\t\t\tnode=next;\n"
+		"\t\t}\n"
+		"\t}\n"
 		"}\n"
 		"\n"
 		//<<opt_class<<"::"<<opt_tokenList<<"::"<<opt_tokenList<<"("<<opt_class<<" *_p):_parser(_p), firstNode(0), lastNode(0)"<<(startConditions.size()>1?", cursc(SC_INITIAL)":"")<<" {}\n"
-		<<opt_class<<"::"<<opt_tokenList<<"::"<<opt_tokenList<<"():firstNode(0), lastNode(0)"<<(startConditions.size()>1?", cursc(SC_INITIAL)":"")<<" {}\n"
+		"void *"<<opt_class<<"::"<<opt_tokenList<<"::Node::operator new(size_t size, "<<opt_tokenList<<"::Allocator *allocator) {\n"
+		"\treturn allocator?allocator->allocate(size): ::operator new(size);\n"
+		"}\n"
+		"\n"
+		//the size is not known here, so what a throwing constructor leaves behind
+		//stays with the allocator until it is destroyed
+		"void "<<opt_class<<"::"<<opt_tokenList<<"::Node::operator delete(void *p, "<<opt_tokenList<<"::Allocator *allocator) {\n"
+		"\tif(!allocator)::operator delete(p);\n"
+		"}\n"
+		"\n"
+		<<opt_class<<"::"<<opt_tokenList<<"::"<<opt_tokenList<<"(Allocator *a):allocator(a), firstNode(0), lastNode(0)"<<(startConditions.size()>1?", cursc(SC_INITIAL)":"")<<" {}\n"
 		"\n"
 		<<opt_class<<"::"<<opt_tokenList<<"::~"<<opt_tokenList<<"() {\n"
-		"\tif(firstNode)delete firstNode;\n"
+		"\tdeleteNode(allocator, firstNode);\n"
 		"}\n"
 		"\n"
 		//"void "<<opt_class<<"::"<<opt_tokenList<<"::eof() {\n"
 		//"\t"<<opt_tokenList<<"::Node *newNode(new "<<opt_tokenList<<"::Node("<<cfg.terminalCount()<<(opt_info_type.length()?QString(", _parser->%1()").arg(opt_info_func):QString(""))<<"));\n"
 		"void "<<opt_class<<"::"<<opt_tokenList<<"::eof() {\n"
-		"\t"<<opt_tokenList<<"::Node *newNode(new "<<opt_tokenList<<"::Node("<<cfg.terminalCount()<<(opt_info_type.length()?QString(", %1::%2()").arg(opt_class).arg(opt_info_type):QString(""))<<"));\n"
+		"\t"<<opt_tokenList<<"::Node *newNode(new(allocator) "<<opt_tokenList<<"::Node("<<cfg.terminalCount()<<(opt_info_type.length()?QString(", %1::%2()").arg(opt_class).arg(opt_info_type):QString(""))<<"));\n"
 		"\tif(lastNode)lastNode->ref=newNode;\n"
 		"\tlastNode=newNode;\n"
 		"\tif(!firstNode)firstNode=newNode;\n"
@@ -639,10 +825,10 @@ bool Parser::compileTokens(const QMap<QString, int> & startConditions) {
 		ostream<<") {\n";
 		if(t.length()) {
 			//ostream<<"\t"<<opt_tokenList<<"::Node *newNode(new NodeImpl<"<<t<<" >("<<i<<(opt_info_type.length()?QString(", _parser->%1()").arg(opt_info_func):QString(""))<<", val));\n";
-			ostream<<"\t"<<opt_tokenList<<"::Node *newNode(new NodeImpl<"<<t<<" >("<<i<<(opt_info_type.length()?QString(", meta"):QString(""))<<", val));\n";
+			ostream<<"\t"<<opt_tokenList<<"::Node *newNode(new(allocator) NodeImpl<"<<t<<" >("<<i<<(opt_info_type.length()?QString(", meta"):QString(""))<<", val));\n";
 		} else {
 			//ostream<<"\t"<<opt_tokenList<<"::Node *newNode(new Node("<<i<<(opt_info_type.length()?QString(", _parser->%1()").arg(opt_info_func):QString(""))<<"));\n";
-			ostream<<"\t"<<opt_tokenList<<"::Node *newNode(new Node("<<i<<(opt_info_type.length()?QString(", meta"):QString(""))<<"));\n";
+			ostream<<"\t"<<opt_tokenList<<"::Node *newNode(new(allocator) Node("<<i<<(opt_info_type.length()?QString(", meta"):QString(""))<<"));\n";
 		}
 		ostream<<
 			"\tif(lastNode)lastNode->ref=newNode;\n"
@@ -650,57 +836,256 @@ bool Parser::compileTokens(const QMap<QString, int> & startConditions) {
 			"\tif(!firstNode)firstNode=newNode;\n"
 			"}\n"
 			"\n";
+		if(t.length() && !t.endsWith("*")) {
+			ostream<<
+				"#ifdef Q_COMPILER_RVALUE_REFS\n"
+				"void "<<opt_class<<"::"<<opt_tokenList<<"::append"<<sym<<"("<<t<<" && val"<<(opt_info_type.length()?QString(", const %1::%2 & meta").arg(opt_class).arg(opt_info_type):QString(""))<<") {\n"
+				"\t"<<opt_tokenList<<"::Node *newNode(new(allocator) NodeImpl<"<<t<<" >("<<i<<(opt_info_type.length()?QString(", meta"):QString(""))<<", static_cast<"<<t<<" &&>(val)));\n"
+				"\tif(lastNode)lastNode->ref=newNode;\n"
+				"\tlastNode=newNode;\n"
+				"\tif(!firstNode)firstNode=newNode;\n"
+				"}\n"
+				"#endif\n"
+				"\n";
+		}
 	}
 	ostream.flush();
 	return true;
 }
 
 namespace {
-	void printClassesArray(const char *name, const FA & fa, QTextStream & ostream) {
-		ostream<<
-			"\tconst int "<<name<<"[]={\n"
-			"\t\t";
+	//the lexer tables on character level: characters that act the same on every state share a
+	//class, a two-level map of 256 character pages yields the class in a single step
+	struct CharTable {
+		QVector<int> pageIndex;
+		QVector<int> pages;
+		int classes;
+		int lastCode;
+		int nul;//the class of character 0 if it is replaced by a sentinel class
+		QVector<int> states;
+		QVector<int> rows;
+	};
+	
+	quint32 hashColumn(const QVector<int> & v) {
+		quint32 h(2166136261u);
+		for(int i=0; i<v.size(); i++) {
+			h^=(quint32)v[i];
+			h*=16777619u;
+		}
+		return h;
+	}
+	
+	int internColumn(const QVector<int> & v, QList<QVector<int> > & columns, QHash<quint32, QList<int> > & index) {
+		QList<int> & bucket=index[hashColumn(v)];
+		foreach(int id, bucket) {
+			if(columns[id]==v)return id;
+		}
+		bucket.append(columns.size());
+		columns.append(v);
+		return columns.size()-1;
+	}
+	
+	//chunked: fa reads every character as 7 bit chunks, otherwise it reads bytes directly;
+	//the rows of the roots come first, in the given order;
+	//sentinel: character 0 gets an extra class without any transitions
+	CharTable buildCharTable(const FA & fa, bool chunked, const QVector<int> & roots, bool sentinel) {
+		const int n(fa.count());
 		const int nranges(fa.rangeCount());
-		int col(0);
+		const int ncodes(chunked?0x110000:256);
+		QVector<QVector<FA::State> > trans(n);
+		for(int s=0; s<n; s++)trans[s]=fa.transitions(FA::State(s));
+		
+		//the effect of a character on all states is a column, column 0 reads nothing
+		QList<QVector<int> > columns;
+		QHash<quint32, QList<int> > index;
+		internColumn(QVector<int>(n, -1), columns, index);
+		QVector<int> chunk(256, 0);
 		for(int r=0; r<nranges; r++) {
 			const FA::Range range(fa.range(r));
-			for(int c=range.from.id(); c<range.to.id(); c++) {
-				if(r || c>range.from.id()) {
-					ostream<<", ";
-					if(!col)ostream<<"\n\t\t";
-				}
-				ostream<<QString("%1").arg(r, 4);
-				col=(col+1)%10;
+			for(int x=range.from.id(); x<range.to.id() && x<256; x++) {
+				QVector<int> v(n);
+				for(int s=0; s<n; s++)v[s]=trans[s][r].id();
+				chunk[x]=internColumn(v, columns, index);
+			}
+		}
+		QVector<int> column(ncodes);
+		QHash<quint64, int> composed;
+		for(int c=0; c<ncodes; c++) {
+			if(c<128 || !chunked) {
+				column[c]=chunk[c];
+				continue;
+			}
+			const int first(chunk[(c&127)|128]);
+			const int rest(column[c>>7]);
+			const quint64 key(((quint64)first<<32)|(quint32)rest);
+			QHash<quint64, int>::const_iterator it(composed.find(key));
+			if(it!=composed.end()) {
+				column[c]=it.value();
+				continue;
 			}
-			if(r<nranges-1) {
-				const FA::Range & next=fa.range(r+1);
-				for(int c=range.to.id(); c<next.from.id(); c++) {
-					ostream<<", ";
-					if(!col)ostream<<"\n\t\t";
-					ostream<<"  -1";
-					col=(col+1)%10;
+			QVector<int> v(n, -1);
+			if(first && rest) {
+				const QVector<int> f(columns[first]);
+				const QVector<int> g(columns[rest]);
+				for(int s=0; s<n; s++) {
+					if(f[s]>=0)v[s]=g[f[s]];
 				}
 			}
+			column[c]=internColumn(v, columns, index);
+			composed.insert(key, column[c]);
 		}
-		ostream<<
-			"\n"
-			"\t};\n";
-	}
-
-	void printTransitionsArray(const char *name, const FA & fa, QTextStream & ostream) {
-		const int n(fa.count());
-		const int nranges(fa.rangeCount());
-		ostream<<"\tconst int "<<name<<"[]={";
-		for(int s=0; s<n; s++) {
-			const QVector<FA::State> v(fa.transitions(FA::State(s)));
-			Q_ASSERT(v.size()==nranges);
-			for(int r=0; r<nranges; r++) {
-				if(s || r)ostream<<", ";
-				if(!r)ostream<<"\n\t\t";
-				ostream<<QString("%1").arg(v[r].id(), 4);
+		
+		QVector<int> used;
+		QVector<bool> isUsed(columns.size());
+		for(int c=0; c<ncodes; c++) {
+			if(!column[c] || isUsed[column[c]])continue;
+			isUsed[column[c]]=true;
+			used.append(column[c]);
+		}
+		
+		CharTable res;
+		QVector<int> row(n, -1);
+		foreach(int s, roots) {
+			if(s<0 || row[s]>=0)continue;
+			row[s]=res.states.size();
+			res.states.append(s);
+		}
+		for(int i=0; i<res.states.size(); i++) {
+			const int s(res.states[i]);
+			foreach(int id, used) {
+				const int t(columns[id][s]);
+				if(t<0 || row[t]>=0)continue;
+				row[t]=res.states.size();
+				res.states.append(t);
+			}
+		}
+		
+		//columns that agree on the kept states become one class
+		const int nrows(res.states.size());
+		QList<QVector<int> > classes;
+		QHash<quint32, QList<int> > classIndex;
+		QVector<int> classOf(columns.size(), -1);
+		foreach(int id, used) {
+			QVector<int> v(nrows);
+			for(int i=0; i<nrows; i++) {
+				const int t(columns[id][res.states[i]]);
+				v[i]=t<0?-1:row[t];
 			}
+			classOf[id]=internColumn(v, classes, classIndex);
+		}
+		res.nul=-1;
+		if(sentinel) {
+			res.nul=classOf[column[0]];
+			classOf.append(classes.size());
+			column[0]=classOf.size()-1;
+			classes.append(QVector<int>(nrows, -1));
+		}
+		res.classes=classes.size();
+		res.rows=QVector<int>(nrows*res.classes);
+		for(int k=0; k<res.classes; k++) {
+			for(int i=0; i<nrows; i++)res.rows[i*res.classes+k]=classes[k][i];
+		}
+		
+		res.lastCode=-1;
+		for(int c=0; c<ncodes; c++) {
+			if(classOf[column[c]]>=0)res.lastCode=c;
+		}
+		QList<QVector<int> > pages;
+		QHash<quint32, QList<int> > pageIndex;
+		for(int p=0; p<=res.lastCode>>8; p++) {
+			QVector<int> v(256);
+			for(int c=0; c<256; c++) {
+				const int code((p<<8)+c);
+				v[c]=code<=res.lastCode?classOf[column[code]]:-1;
+			}
+			res.pageIndex.append(internColumn(v, pages, pageIndex));
+		}
+		foreach(const QVector<int> & page, pages)res.pages+=page;
+		return res;
+	}
+	
+	//the smallest type holding all values, small tables stay in the cache; with
+	//shifted set, a table using -1 as its only negative value is stored plus one
+	//when that makes it fit into an unsigned type of half the size
+	QString intType(const QVector<int> & v, bool shifted, int & bias) {
+		int lo(0);
+		int hi(0);
+		foreach(int i, v) {
+			lo=qMin(lo, i);
+			hi=qMax(hi, i);
+		}
+		bias=0;
+		if(shifted && lo==-1 && ((hi>=128 && hi<255) || (hi>=32768 && hi<65535))) {
+			bias=1;
+			lo=0;
+			++hi;
+		}
+		if(lo>=0) {
+			if(hi<=255)return "quint8";
+			if(hi<=65535)return "quint16";
+		} else {
+			if(lo>=-128 && hi<=127)return "qint8";
+			if(lo>=-32768 && hi<=32767)return "qint16";
+		}
+		return "int";
+	}
+	
+	//returns what has to be subtracted from the stored values
+	int printIntArray(const char *name, const QVector<int> & v, int columns, QTextStream & ostream, bool shifted=false) {
+		int bias;
+		ostream<<"\tconst "<<intType(v, shifted, bias)<<" "<<name<<"[]={";
+		for(int i=0; i<v.size(); i++) {
+			if(i)ostream<<", ";
+			if(!(i%columns))ostream<<"\n\t\t";
+			ostream<<QString("%1").arg(v[i]+bias, 4);
 		}
 		ostream<<"\n\t};\n";
+		return bias;
+	}
+	
+	//a run of character codes that lead to the same value
+	struct CodeRange {
+		int from;
+		int to;
+		int value;
+		CodeRange(int f, int t, int v):from(f), to(t), value(v) {}
+	};
+	
+	QList<CodeRange> classRanges(const CharTable & table) {
+		QList<CodeRange> res;
+		for(int c=0; c<=table.lastCode; c++) {
+			const int cls(table.pages[table.pageIndex[c>>8]*256+(c&255)]);
+			if(res.size() && res.last().value==cls) {
+				res.last().to=c;
+			} else {
+				res.append(CodeRange(c, c, cls));
+			}
+		}
+		return res;
+	}
+	
+	//binary search over the ranges as nested comparisons of variable, a range runs hit
+	//with its value as %1 and codes between the ranges run miss
+	void printRangeCascade(const QList<CodeRange> & ranges, int from, int to, const QString & variable, const QString & hit, const QString & miss, const QString & indent, QTextStream & ostream) {
+		if(to-from>4) {
+			const int mid((from+to)/2);
+			ostream<<indent<<"if("<<variable<<"<"<<ranges[mid].from<<") {\n";
+			printRangeCascade(ranges, from, mid, variable, hit, miss, indent+"\t", ostream);
+			ostream<<indent<<"} else {\n";
+			printRangeCascade(ranges, mid, to, variable, hit, miss, indent+"\t", ostream);
+			ostream<<indent<<"}\n";
+			return;
+		}
+		for(int i=from; i<to; i++) {
+			const CodeRange & r=ranges[i];
+			const QString code(QString(hit).replace("%1", QString::number(r.value)));
+			if(r.from==r.to) {
+				ostream<<indent<<"if("<<variable<<"=="<<r.from<<")"<<code<<"\n";
+			} else {
+				ostream<<indent<<"if("<<variable<<">="<<r.from<<" && "<<variable<<"<="<<r.to<<")"<<code<<"\n";
+			}
+		}
+		if(miss.length())ostream<<indent<<miss<<"\n";
 	}
 }
 
@@ -734,8 +1119,23 @@ bool Parser::compilePatterns(const QMap<QString, int> & startConditions) {
 	const QString & opt_info_func=options[OptionInfoFunc];
 	const QString & opt_char_type=options[OptionCharType];
 	const QString & opt_error=options[OptionError];
+	const QString & opt_refill=options[OptionRefill];
+	const QString & opt_token_view=options[OptionTokenView];
+	const QString & opt_parse_file=options[OptionParseFile];
+	const QString & opt_parse_stream=options[OptionParseStream];
+	const QString & opt_buffer_size=options[OptionBufferSize];
+	const QString & opt_max_token=options[OptionMaxTokenLength];
+	const bool utf8(options[OptionEncoding]=="utf8");
+	const bool buffered(options[OptionInput]=="buffer");
+	//latin1 uses the automata of utf16, but buffers hold bytes like with utf8
+	const bool bytes(utf8 || (buffered && options[OptionEncoding]=="latin1"));
+	const bool devices(opt_parse_file.length() || opt_parse_stream.length());
+	if(devices && !(buffered && bytes)) {
+		error("#option parseFile and parseStream need #option Input buffer and #option Encoding utf8 or latin1.");
+		return false;
+	}
 	int i(0);
-	FA fa;
+	FA::Builder nfa;
 	QList<FA::State> starts;
 	foreach(const Pattern & pattern, patterns) {
 /*		if(!reparser.parse(pattern.re, i)) {
@@ -744,9 +1144,11 @@ bool Parser::compilePatterns(const QMap<QString, int> & startConditions) {
 		}
 		starts.append(fa.insert(reparser.result()).first);
 		i++;*/
-		starts.append(fa.insert(pattern.fa).first);
+		starts.append(nfa.insert(pattern.fa).first);
 		i++;
 	}
+	FA fa(nfa.finalize());
+	QVector<FA::Symbol> scSymbols;
 	if(startConditions.size()>1) {
 		if(fa.rangeCount()<startConditions.size()) {
 			const FA::State d1(fa.addState());
@@ -755,6 +1157,7 @@ bool Parser::compilePatterns(const QMap<QString, int> & startConditions) {
 				fa.addTransition(d1, FA::Range(fa.range(fa.rangeCount()-1).to), d2);
 			}
 		}
+		for(int k=0; k<startConditions.size(); k++)scSymbols.append(fa.range(k).from);
 		i=0;
 		foreach(const Pattern & pattern, patterns) {
 			QSet<QString> sc(pattern.sc);
@@ -790,132 +1193,519 @@ bool Parser::compilePatterns(const QMap<QString, int> & startConditions) {
 	}
 	fa=fa.minimal();
 // 	fa.print();
-	n=fa.count();
 	
-	const int nranges(fa.rangeCount());
-	const int firstCode(fa.range(0).from.id());
-	const int lastCode(fa.range(nranges-1).to.id()-1);
+	QVector<int> roots;
+	if(startConditions.size()>1) {
+		foreach(FA::Symbol c, scSymbols)roots.append(fa.transition(fa.start(), c).id());
+	} else {
+		roots.append(fa.start().id());
+	}
+	const CharTable table(buildCharTable(fa, !utf8, roots, buffered));
+	n=table.states.size();
+	const bool paged(table.pageIndex.size()>1);
+	const bool direct(options[OptionLexerStyle]=="direct");
 	
 	ostream<<
 		"\n"
 		"namespace {\n";
-	printClassesArray("lc", fa, ostream);
-	ostream<<
-		"\n";
-	printTransitionsArray("lt", fa, ostream);
-	ostream<<
-		"\n"
-		"\tconst int lm[]={\n\t\t";
-	for(int s=0; s<n; s++) {
-		const QSet<FA::Mark> m(fa.marks(FA::State(s)));
-		if(s)ostream<<", ";
-		if(m.size()) {
-			ostream<<(m.begin()->id());
-		} else {
-			ostream<<"-1";
+	QString lcBias;
+	QString ltBias;
+	QList<CodeRange> classes;
+	if(direct) {
+		//the automaton is compiled into lex(), which only asks whether a character
+		//belongs to any pattern when it stops on it
+		classes=classRanges(table);
+		QList<CodeRange> known;
+		foreach(const CodeRange & r, classes) {
+			if(r.value<0)continue;
+			if(known.size() && known.last().to+1==r.from) {
+				known.last().to=r.to;
+			} else {
+				known.append(CodeRange(r.from, r.to, 1));
+			}
+		}
+		ostream<<
+			"\tbool known(int c) {\n";
+		printRangeCascade(known, 0, known.size(), "c", "return true;", "return false;", "\t\t", ostream);
+		ostream<<
+			"\t}\n";
+	} else {
+		if(paged) {
+			printIntArray("lp", table.pageIndex, 16, ostream);
+			ostream<<
+				"\n";
 		}
+		lcBias=printIntArray("lc", table.pages, 16, ostream, true)?"-1":"";
+		ostream<<
+			"\n";
+		ltBias=printIntArray("lt", table.rows, table.classes, ostream, true)?"-1":"";
+	}
+	QString lsBias;
+	if(startConditions.size()>1) {
+		QVector<int> ls;
+		foreach(int s, roots)ls.append(s<0?-1:table.states.indexOf(s));
+		ostream<<
+			"\n";
+		lsBias=printIntArray("ls", ls, 16, ostream, true)?"-1":"";
+	}
+	const QString root(startConditions.size()>1?"ls[state.list.startCondition()]"+lsBias:"0");
+	QString lmBias;
+	if(!direct) {
+		QVector<int> lm;
+		for(int s=0; s<n; s++) {
+			const QSet<FA::Mark> m(fa.marks(FA::State(table.states[s])));
+			lm.append(m.size()?m.begin()->id():-1);
+		}
+		ostream<<
+			"\n";
+		lmBias=printIntArray("lm", lm, 16, ostream, true)?"-1":"";
 	}
 	
 	const QString string_type(opt_class+"::"+opt_string_type);
+	const QString unit_type(bytes?QString("char"):opt_class+"::"+opt_char_type);
+	const QString view_type(opt_class+"::"+opt_token_view);
+	//how the generated code reads the token text and drops a bad character
+	QString text("token");
+	QString skip("state.currentChar=-1;");
+	
+	if(buffered) {
+		//tokens are views into the buffer, their text is only built on demand
+		hstream<<
+			"struct "<<view_type<<" {\n"
+			"\tconst "<<unit_type<<" *begin;\n"
+			"\tint length;\n"
+			"\t"<<opt_token_view<<"(const "<<unit_type<<" *b, int l):begin(b), length(l) {}\n"
+			"\t"<<string_type<<" toString()const {return "<<string_type<<(utf8?"::fromUtf8(begin, length)":bytes?"::fromLatin1(begin, length)":"(begin, length)")<<";}\n"
+			"\toperator "<<string_type<<"()const {return toString();}\n"
+			"};\n"
+			"\n";
+		hstream.flush();
+		text="token.toString()";
+		skip="state.current=p+1;";
+	}
 	
 	ostream<<
-		"\n"
-		"\t};\n"
-		"\n"
+		"\n";
+	QString refill("this->"+opt_refill+"(state.current, state.end)");
+	if(devices) {
+		//files are mapped if the end of the last page is zero filled, which is
+		//where the sentinel goes, otherwise they are read in blocks of fixed size
+		refill=QString("(state.input?state.input->refill(state.current, state.end):%1)").arg(refill);
+		ostream<<
+			"\tclass DeviceInput {\n"
+			"\t\tprivate:\n"
+			"\t\t\tQIODevice & device;\n"
+			"\t\t\tQFile *file;\n"
+			"\t\t\tuchar *mapped;\n"
+			"\t\t\tqint64 size;\n"
+			"\t\t\tQByteArray block;\n"
+			"\t\tpublic:\n"
+			"\t\t\tDeviceInput(QIODevice & d, QFile *f=0):device(d), file(f), mapped(0), size(0) {\n"
+			"\t\t\t\tif(file)size=file->size();\n"
+			"\t\t\t\tif(size%4096)mapped=file->map(0, size);\n"
+			"\t\t\t}\n"
+			"\t\t\t~DeviceInput() {\n"
+			"\t\t\t\tif(mapped)file->unmap(mapped);\n"
+			"\t\t\t}\n"
+			"\t\t\tbool refill(const char *& begin, const char *& end) {\n"
+			"\t\t\t\tif(mapped) {\n"
+			"\t\t\t\t\tif(!size)return false;\n"
+			"\t\t\t\t\tbegin=(const char *)mapped;\n"
+			"\t\t\t\t\tend=begin+size;\n"
+			"\t\t\t\t\tsize=0;\n"
+			"\t\t\t\t\treturn true;\n"
+			"\t\t\t\t}\n"
+			"\t\t\t\tif(block.isEmpty())block.resize("<<opt_buffer_size<<");\n"
+			"\t\t\t\tconst qint64 n(device.read(block.data(), "<<opt_buffer_size<<"));\n"
+			"\t\t\t\tif(n<=0)return false;\n"
+			"\t\t\t\tblock.data()[n]=0;\n"
+			"\t\t\t\tbegin=block.constData();\n"
+			"\t\t\t\tend=begin+n;\n"
+			"\t\t\t\treturn true;\n"
+			"\t\t\t}\n"
+			"\t};\n"
+			"\n";
+	}
+	//tokens are limited in characters, a code point takes up to four bytes in
+	//UTF-8 and two code units in UTF-16, so only tokens with more units are counted
+	const bool countCharacters(buffered && opt_max_token.length() && (utf8 || !bytes));
+	QString carryTooLong(QString("state.carry.size()>%1").arg(opt_max_token));
+	QString tokenTooLong(QString("length>%1").arg(opt_max_token));
+	if(countCharacters) {
+		carryTooLong+=QString(" && characters(state.carry.constData(), state.carry.size())>%1").arg(opt_max_token);
+		tokenTooLong+=QString(" && characters(begin, length)>%1").arg(opt_max_token);
+		ostream<<
+			"\tint characters(const "<<unit_type<<" *p, int length) {\n"
+			"\t\tint n(0);\n"
+			"\t\tfor(int i=0; i<length; i++)if("<<(utf8?"(p[i]&0xC0)!=0x80":"(p[i].unicode()&0xFC00)!=0xDC00")<<")n++;\n"
+			"\t\treturn n;\n"
+			"\t}\n"
+			"\t\n";
+	}
+	ostream<<
 		"}\n"
 		"\n"
 		"struct "<<opt_class<<"::"<<opt_lexer_state<<" {\n"
-		"\tint currentChar;\n"
-		"\t"<<opt_tokenList<<"Impl list;\n"
-		//"\t"<<opt_lexer_state<<"("<<opt_class<<" *_p):currentChar(-1), list(_p)"//_parser
-		"\t"<<opt_lexer_state<<"():currentChar(-1)"
-		" {}\n"
-		"};\n"
-		"\n"
-		"bool "<<opt_class<<"::"<<opt_lex<<"("<<opt_lexer_state<<" & state) {\n"
-		"\tint curc(state.currentChar);\n"
-		"\tif(curc<0) {\n"
-		"\t\tcurc="<<opt_next_char<<"();\n"
-		"\t\tif(curc<0) {\n"
-// 		"\t\t\tstate.list.append(new "<<opt_tokenList<<"::Node("<<cfg.terminalCount()<<"));\n"
-		"\t\t\tstate.list.eof();\n"
-		"\t\t\treturn true;\n"
-		"\t\t}\n"
-		"\t}\n"
-		"\tint fastate(";
-	if(startConditions.size()>1) {
-		ostream<<"lt[state.list.startCondition()+"<<(nranges*fa.start().id())<<"]";
+		"\t"<<opt_tokenList<<"::Allocator allocator;\n";
+	if(buffered) {
+		ostream<<
+			"\tconst "<<unit_type<<" *current;\n"
+			"\tconst "<<unit_type<<" *end;\n"
+			"\tbool done;\n"
+			"\tQVector<"<<unit_type<<" > carry;\n";
+		if(devices)ostream<<"\tDeviceInput *input;\n";
+		ostream<<
+			"\t"<<opt_tokenList<<"Impl list;\n"
+			"\t"<<opt_lexer_state<<"("<<(devices?"DeviceInput *i=0":"")<<"):current(0), end(0), done(false)"<<(devices?", input(i)":"")<<", list(&allocator) {}\n"
+			"\tbool "<<options[OptionParse]<<"("<<opt_class<<" & parser);\n"
+			"};\n"
+			"\n";
+		if(opt_parse_file.length()) {
+			ostream<<
+				"bool "<<opt_class<<"::"<<opt_parse_file<<"(const QString & name) {\n"
+				"\tQFile file(name);\n"
+				"\tif(!file.open(QFile::ReadOnly)) {\n"
+				"\t\t"<<opt_error<<"(QString(\"Cannot open file '%1'.\").arg(name));\n"
+				"\t\treturn false;\n"
+				"\t}\n"
+				"\tDeviceInput input(file, &file);\n"
+				"\t"<<opt_lexer_state<<" state(&input);\n"
+				"\treturn state."<<options[OptionParse]<<"(*this);\n"
+				"}\n"
+				"\n";
+		}
+		if(opt_parse_stream.length()) {
+			ostream<<
+				"bool "<<opt_class<<"::"<<opt_parse_stream<<"(QIODevice & device) {\n"
+				"\tDeviceInput input(device);\n"
+				"\t"<<opt_lexer_state<<" state(&input);\n"
+				"\treturn state."<<options[OptionParse]<<"(*this);\n"
+				"}\n"
+				"\n";
+		}
+		ostream<<
+			"bool "<<opt_class<<"::"<<opt_lex<<"("<<opt_lexer_state<<" & state) {\n"
+			"\twhile(state.current==state.end) {\n"
+			"\t\tif(state.done || !"<<refill<<") {\n"
+			"\t\t\tstate.done=true;\n"
+			"\t\t\tstate.list.eof();\n"
+			"\t\t\treturn true;\n"
+			"\t\t}\n"
+			"\t}\n"
+			"\tconst "<<unit_type<<" *p(state.current);\n"
+			"\tconst "<<unit_type<<" *start(p);\n"
+			"\tif(state.carry.size())state.carry.clear();\n";
+	} else {
+		ostream<<
+			"\tint currentChar;\n"
+			"\t"<<opt_tokenList<<"Impl list;\n"
+			//"\t"<<opt_lexer_state<<"("<<opt_class<<" *_p):currentChar(-1), list(_p)"//_parser
+			"\t"<<opt_lexer_state<<"():currentChar(-1), list(&allocator)"
+			" {}\n"
+			"\tbool "<<options[OptionParse]<<"("<<opt_class<<" & parser);\n"
+			"};\n"
+			"\n"
+			"bool "<<opt_class<<"::"<<opt_lex<<"("<<opt_lexer_state<<" & state) {\n"
+			"\tint curc(state.currentChar);\n"
+			"\tif(curc<0) {\n"
+			"\t\tcurc="<<opt_next_char<<"();\n"
+			"\t\tif(curc<0) {\n"
+// 			"\t\t\tstate.list.append(new "<<opt_tokenList<<"::Node("<<cfg.terminalCount()<<"));\n"
+			"\t\t\tstate.list.eof();\n"
+			"\t\t\treturn true;\n"
+			"\t\t}\n"
+			"\t}\n";
+		if(!direct)ostream<<"\tint fastate("<<root<<");\n";
+		if(utf8) {
+			//the input is read byte by byte, tokens are decoded once they are complete
+			ostream<<"\tQByteArray bytes;\n";
+		} else {
+			ostream<<"\t"<<string_type<<" token;\n";
+		}
+	}
+	if(direct) {
+		//every state is a label, a transition goes to the label shiftN that consumes
+		//the character before stateN compares the next one against the ranges of its
+		//transitions, the state a token stops in tells its pattern right away
+		QVector<bool> target(n, false);
+		QVector<QList<CodeRange> > transitions(n);
+		for(int s=0; s<n; s++) {
+			QList<CodeRange> & targets=transitions[s];
+			foreach(const CodeRange & r, classes) {
+				const int t(r.value<0?-1:table.rows[s*table.classes+r.value]);
+				if(t<0)continue;
+				target[t]=true;
+				if(targets.size() && targets.last().value==t && targets.last().to+1==r.from) {
+					targets.last().to=r.to;
+				} else {
+					targets.append(CodeRange(r.from, r.to, t));
+				}
+			}
+			if(buffered && table.nul>=0) {
+				const int t(table.rows[s*table.classes+table.nul]);
+				if(t>=0)target[t]=true;
+			}
+		}
+		QVector<bool> entered(n, buffered);
+		if(buffered) {
+			ostream<<
+				"\tint curc;\n"
+				"\tint fastate;\n";
+		}
+		ostream<<
+			"\tint m;\n";
+		if(startConditions.size()>1) {
+			ostream<<
+				"\tswitch("<<root<<") {\n";
+			QSet<int> cases;
+			foreach(int r, roots) {
+				const int s(r<0?-1:table.states.indexOf(r));
+				if(s<0 || cases.contains(s))continue;
+				cases.insert(s);
+				entered[s]=true;
+				ostream<<
+					"\t\tcase "<<s<<":\n"
+					"\t\t\tgoto state"<<s<<";\n";
+			}
+			ostream<<
+				"\t}\n";
+			if(roots.contains(-1)) {
+				//a start condition without patterns knows no token at all
+				if(buffered)ostream<<"\tcurc="<<(bytes?"(unsigned char)*p":"p->unicode()")<<";\n\tfastate=-1;\n";
+				ostream<<
+					"\tm=-1;\n"
+					"\tgoto stop;\n";
+			}
+		} else if(target[0]) {
+			entered[0]=true;
+			ostream<<
+				"\tgoto state0;\n";
+		}
+		for(int s=0; s<n; s++) {
+			if(target[s]) {
+				ostream<<"shift"<<s<<":\n";
+				if(buffered) {
+					ostream<<"\t++p;\n";
+				} else {
+					if(utf8) {
+						ostream<<"\tbytes.append(char(curc));\n";
+					} else {
+						ostream<<"\ttoken.append("<<opt_class<<"::"<<opt_char_type<<"(curc));\n";
+					}
+					ostream<<"\tcurc="<<opt_next_char<<"();\n";
+				}
+			}
+			if(entered[s])ostream<<"state"<<s<<":\n";
+			if(buffered)ostream<<"\tcurc="<<(bytes?"(unsigned char)*p":"p->unicode()")<<";\n";
+			printRangeCascade(transitions[s], 0, transitions[s].size(), "curc", "goto shift%1;", "", "\t", ostream);
+			const QSet<FA::Mark> marks(fa.marks(FA::State(table.states[s])));
+			if(buffered)ostream<<"\tfastate="<<s<<";\n";
+			ostream<<
+				"\tm="<<(marks.size()?marks.begin()->id():-1)<<";\n"
+				"\tgoto stop;\n";
+		}
+		if(buffered) {
+			//after a refill the token goes on in the state it stopped in
+			ostream<<
+				"resume:\n"
+				"\tswitch(fastate) {\n";
+			for(int s=0; s<n; s++) {
+				ostream<<
+					"\t\tcase "<<s<<":\n"
+					"\t\t\tgoto state"<<s<<";\n";
+			}
+			ostream<<
+				"\t}\n";
+		}
+		ostream<<
+			"stop:\n";
 	} else {
-		ostream<<fa.start().id();
+		if(buffered) {
+			ostream<<
+				"\tint fastate("<<root<<");\n"
+				"\twhile(true) {\n"
+				"\t\tconst int curc("<<(bytes?"(unsigned char)*p":"p->unicode()")<<");\n";
+		} else {
+			ostream<<
+				"\twhile(true) {\n"
+				"\t\tint n(-1);\n"
+				"\t\tif(curc>=0) {\n";
+		}
+		const QString indent(buffered?"\t\t":"\t\t\t");
+		ostream<<
+			indent<<"if(curc>"<<table.lastCode<<") {\n"<<
+			indent<<"\t"<<opt_issue<<"(QString(\"Read unknown symbol with code %1.\").arg(curc));\n"<<
+			indent<<"\t"<<skip<<"\n"<<
+			indent<<"\treturn false;\n"<<
+			indent<<"}\n"<<
+			indent<<"const int r("<<(paged?"(curc<256?lc[curc]:lc[lp[curc>>8]*256+(curc&255)])":"lc[curc]")<<lcBias<<");\n"<<
+			indent<<"if(r<0) {\n"<<
+			indent<<"\t"<<opt_issue<<"(QString(\"Read unknown symbol with code %1.\").arg(curc));\n"<<
+			indent<<"\t"<<skip<<"\n"<<
+			indent<<"\treturn false;\n"<<
+			indent<<"}\n";
+		if(buffered) {
+			ostream<<
+				"\t\tint n(lt[fastate*"<<table.classes<<"+r]"<<ltBias<<");\n"
+				"\t\tif(n<0) {\n";
+		} else {
+			ostream<<
+				"\t\t\tn=lt[fastate*"<<table.classes<<"+r]"<<ltBias<<";\n"
+				"\t\t}\n"
+				"\t\tif(n<0) {\n";
+		}
 	}
+	//the end of a token, inside the loop of the table lexer or at the label stop
+	//of the direct lexer
+	const QString in(direct?"\t":"\t\t\t");
+	const QString unknown(
+		in+"\t"+opt_issue+"(QString(\"Read unknown symbol with code %1.\").arg(curc));\n"+
+		in+"\t"+skip+"\n"+
+		in+"\treturn false;\n");
+	if(buffered) {
+		//the character behind the block is a sentinel of its own class, so the
+		//end of the block is only tested when the automaton stops
+		ostream<<
+			in<<"if(p==state.end) {\n"<<
+			in<<"\tif(!state.done) {\n"<<
+			in<<"\t\t//the token goes on in the next block, keep what was read so far\n"<<
+			in<<"\t\tfor(; start!=p; ++start)state.carry.append(*start);\n";
+		if(opt_max_token.length()) {
+			ostream<<
+				in<<"\t\tif("<<carryTooLong<<") {\n"<<
+				in<<"\t\t\t"<<opt_error<<"(QString(\"Token longer than "<<opt_max_token<<" characters.\"));\n"<<
+				in<<"\t\t\treturn false;\n"<<
+				in<<"\t\t}\n";
+		}
+		ostream<<
+			in<<"\t\tif("<<refill<<") {\n"<<
+			in<<"\t\t\tp=start=state.current;\n"<<
+			in<<"\t\t\t"<<(direct?"goto resume;":"continue;")<<"\n"<<
+			in<<"\t\t}\n"<<
+			in<<"\t\tstate.done=true;\n"<<
+			in<<"\t\tstate.end=p;\n"<<
+			in<<"\t}\n"<<
+			in<<"} else if(!curc) {\n";
+		if(table.nul<0) {
+			ostream<<unknown;
+		} else if(direct) {
+			ostream<<
+				in<<"\tswitch(fastate) {\n";
+			for(int s=0; s<n; s++) {
+				const int t(table.rows[s*table.classes+table.nul]);
+				if(t<0)continue;
+				ostream<<
+					in<<"\t\tcase "<<s<<":\n"<<
+					in<<"\t\t\tgoto shift"<<t<<";\n";
+			}
+			ostream<<
+				in<<"\t}\n";
+		} else {
+			ostream<<
+				in<<"\tn=lt[fastate*"<<table.classes<<"+"<<table.nul<<"]"<<ltBias<<";\n";
+		}
+		if(direct) {
+			ostream<<
+				in<<"} else if(!known(curc)) {\n"<<
+				unknown;
+		}
+		ostream<<
+			in<<"}\n";
+		if(!direct) {
+			ostream<<
+				"\t\t}\n"
+				"\t\tif(n<0) {\n";
+		}
+		ostream<<
+			in<<"state.current=p;\n"<<
+			in<<"const "<<unit_type<<" *begin(start);\n"<<
+			in<<"int length(p-start);\n"<<
+			in<<"if(state.carry.size()) {\n"<<
+			in<<"\tfor(; start!=p; ++start)state.carry.append(*start);\n"<<
+			in<<"\tbegin=state.carry.constData();\n"<<
+			in<<"\tlength=state.carry.size();\n"<<
+			in<<"}\n"<<
+			in<<"const "<<view_type<<" token(begin, length);\n";
+		if(opt_max_token.length()) {
+			ostream<<
+				in<<"if("<<tokenTooLong<<") {\n"<<
+				in<<"\t"<<opt_error<<"(QString(\"Token longer than "<<opt_max_token<<" characters.\"));\n"<<
+				in<<"\treturn false;\n"<<
+				in<<"}\n";
+		}
+	} else {
+		if(direct) {
+			ostream<<
+				in<<"if(curc>=0 && !known(curc)) {\n"<<
+				unknown<<
+				in<<"}\n";
+		}
+		if(utf8) {
+			ostream<<in<<"const "<<string_type<<" token("<<string_type<<"::fromUtf8(bytes.constData(), bytes.size()));\n";
+		}
+		ostream<<in<<"state.currentChar=curc;\n";
+	}
+	if(!direct)ostream<<in<<"const int m(lm[fastate]"<<lmBias<<");\n";
 	ostream<<
-		");\n"
-		"\t"<<string_type<<" token;\n"
-		"\twhile(true) {\n"
-		"\t\tint n(-1);\n"
-		"\t\tif(curc>=0) {\n"
-		"\t\t\tn=fastate;\n"
-		"\t\t\tint c(curc);\n"
-		"\t\t\tdo {\n"
-		"\t\t\t\tint ec(c&127);\n"
-		"\t\t\t\tc=c>>7;\n"
-		"\t\t\t\tif(c)ec|=128;\n"
-		"\t\t\t\tif(ec<"<<firstCode<<" || ec>"<<lastCode<<") {\n"
-		"\t\t\t\t\t"<<opt_issue<<"(QString(\"Read unknown symbol with code %1.\").arg(curc));\n"
-		"\t\t\t\t\tstate.currentChar=-1;\n"
-		"\t\t\t\t\treturn false;\n"
-		"\t\t\t\t}\n"
-		"\t\t\t\tconst int r(lc[ec-"<<firstCode<<"]);\n"
-		"\t\t\t\tif(r<0) {\n"
-		"\t\t\t\t\t"<<opt_issue<<"(QString(\"Read unknown symbol with code %1.\").arg(curc));\n"
-		"\t\t\t\t\tstate.currentChar=-1;\n"
-		"\t\t\t\t\treturn false;\n"
-		"\t\t\t\t}\n"
-		"\t\t\t\tn=lt[n*"<<nranges<<"+r];\n"
-		"\t\t\t} while(c && n>=0);\n"
-		"\t\t}\n"
-		"\t\tif(n<0) {\n"
-		"\t\t\tstate.currentChar=curc;\n"
-		"\t\t\tconst int m(lm[fastate]);\n"
-		"\t\t\tif(m<0) {\n"
-		"\t\t\t\t"<<opt_issue<<"(QString(\"Read unknown token:'%1'.\").arg(token));\n"
-		"\t\t\t\tstate.currentChar=-1;\n"
-		"\t\t\t\treturn false;\n"
-		"\t\t\t}\n"
-		"\t\t\tswitch(m) {\n";
+		in<<"if(m<0) {\n"<<
+		in<<"\t"<<opt_issue<<"(QString(\"Read unknown token:'%1'.\").arg("<<text<<"));\n"<<
+		in<<"\t"<<(buffered?"if(p!=state.end)state.current=p+1;":"state.currentChar=-1;")<<"\n"<<
+		in<<"\treturn false;\n"<<
+		in<<"}\n"<<
+		in<<"switch(m) {\n";
 	i=0;
 	foreach(const Pattern & p, patterns) {
 		ostream<<
-			"\t\t\t\tcase "<<i<<":\n"
-			"\t\t\t\t\t//"<<p.re<<"\n";
+			in<<"\tcase "<<i<<":\n"<<
+			in<<"\t\t//"<<p.re<<"\n";
 		if(p.func.length()) {
 			if(p.func==opt_dump) {
 				ostream<<
-					"\t\t\t\t\treturn true;\n";
+					in<<"\t\treturn true;\n";
 			} else {
 				ostream<<
-					"\t\t\t\t\tthis->"<<p.func<<"(token, state.list);\n"
-					"\t\t\t\t\treturn !(this->errorFlag());\n";
+					in<<"\t\tthis->"<<p.func<<"(token, state.list);\n"<<
+					in<<"\t\treturn !(this->errorFlag());\n";
 			}
 		} else {
 			CFG::Symbol s(cfg.findSymbol(p.re));
 			Q_ASSERT(s.isValid());
 			Q_ASSERT(s.isTerminal());
-			ostream<<
-				//"\t\t\t\t\tstate.list.append(new "<<opt_tokenList<<"::Node("<<s.hash()<<"));\n"
-				"\t\t\t\t\tstate.list.append(new NodeImpl<"<<string_type<<" >("<<s.hash()<<(opt_info_type.length()?QString(", this->%1()").arg(opt_info_func):QString(""))<<", token));\n"
-				"\t\t\t\t\treturn true;\n";
+			const QString meta(opt_info_type.length()?QString(", this->%1()").arg(opt_info_func):QString(""));
+			if(symtypes.value(s).length()) {
+				ostream<<in<<"\t\tstate.list.append(new(&state.allocator) NodeImpl<"<<string_type<<" >("<<s.hash()<<meta<<", "<<text<<"));\n";
+			} else {
+				//the text of literals used only in productions is never read
+				ostream<<in<<"\t\tstate.list.append(new(&state.allocator) "<<opt_tokenList<<"::Node("<<s.hash()<<meta<<"));\n";
+			}
+			ostream<<in<<"\t\treturn true;\n";
 		}
 		i++;
 	}
 	ostream<<
-		"\t\t\t}\n"
-		"\t\t} else {\n"
-		"\t\t\ttoken.append("<<opt_class<<"::"<<opt_char_type<<"(curc));\n"
-		"\t\t\tfastate=n;\n"
-		"\t\t\tcurc="<<opt_next_char<<"();\n"
-		"\t\t}\n"
-		"\t}\n"
+		in<<"}\n";
+	if(!direct) {
+		ostream<<
+			"\t\t} else {\n";
+		if(buffered) {
+			ostream<<
+				"\t\t\tfastate=n;\n"
+				"\t\t\t++p;\n";
+		} else {
+			if(utf8) {
+				ostream<<"\t\t\tbytes.append(char(curc));\n";
+			} else {
+				ostream<<"\t\t\ttoken.append("<<opt_class<<"::"<<opt_char_type<<"(curc));\n";
+			}
+			ostream<<
+				"\t\t\tfastate=n;\n"
+				"\t\t\tcurc="<<opt_next_char<<"();\n";
+		}
+		ostream<<
+			"\t\t}\n"
+			"\t}\n";
+	}
+	ostream<<
 		"\t"<<opt_error<<"(QString(\"Unexpected end of file.\"));\n"
 		"\treturn false;\n"
 		"}\n"
@@ -927,6 +1717,83 @@ bool Parser::compilePatterns(const QMap<QString, int> & startConditions) {
 }
 
 namespace {
+	//row displacement: the rows share one array of entries, the check array names the row
+	//an entry belongs to and every other cell of a row reads the default of the row
+	struct PackedRows {
+		QVector<int> base;
+		QVector<int> defaults;
+		QVector<int> entries;
+		QVector<int> check;
+	};
+	
+	//negative cells of sparse rows are never read and may take any value
+	PackedRows packRows(const QVector<int> & cells, int width, bool sparse) {
+		const int rows(width?cells.size()/width:0);
+		PackedRows res;
+		res.base.fill(0, rows);
+		res.defaults.fill(-1, rows);
+		res.entries.fill(0, width);
+		res.check.fill(-1, width);
+		QVector<QList<int> > columns(rows);
+		QMap<int, QList<int> > byCount;
+		for(int r=0; r<rows; r++) {
+			QHash<int, int> counts;
+			int best(0);
+			for(int c=0; c<width; c++) {
+				const int v(cells[r*width+c]);
+				if(sparse && v<0)continue;
+				const int n(++counts[v]);
+				if(n>best) {
+					best=n;
+					res.defaults[r]=v;
+				}
+			}
+			for(int c=0; c<width; c++) {
+				const int v(cells[r*width+c]);
+				if(v!=res.defaults[r] && !(sparse && v<0))columns[r].append(c);
+			}
+			byCount[-columns[r].size()].append(r);
+		}
+		//first fit, the fullest rows first
+		int firstFree(0);
+		foreach(const QList<int> & group, byCount) {
+			foreach(int r, group) {
+				const QList<int> & cols=columns[r];
+				if(cols.isEmpty())continue;
+				int base(qMax(0, firstFree-cols.first()));
+				while(true) {
+					bool fits(true);
+					foreach(int c, cols) {
+						if(base+c<res.check.size() && res.check[base+c]>=0) {
+							fits=false;
+							break;
+						}
+					}
+					if(fits)break;
+					++base;
+				}
+				while(res.check.size()<base+width) {
+					res.check.append(-1);
+					res.entries.append(0);
+				}
+				res.base[r]=base;
+				foreach(int c, cols) {
+					res.check[base+c]=r;
+					res.entries[base+c]=cells[r*width+c];
+				}
+				while(firstFree<res.check.size() && res.check[firstFree]>=0)++firstFree;
+			}
+		}
+		return res;
+	}
+	
+	void printPackedRows(const QString & name, const PackedRows & rows, QTextStream & ostream) {
+		printIntArray(QString(name+"Base").toLatin1().constData(), rows.base, 16, ostream);
+		printIntArray(QString(name+"Default").toLatin1().constData(), rows.defaults, 16, ostream);
+		printIntArray(QString(name+"Entry").toLatin1().constData(), rows.entries, 16, ostream);
+		printIntArray(QString(name+"Check").toLatin1().constData(), rows.check, 16, ostream);
+	}
+	
 	class Compiler {
 		private:
 			CFG cfg;
@@ -939,26 +1806,28 @@ namespace {
 			QVector<int> sr;
 			
 			QStringList errmsg;
+			QString stats;
 			void error(const QString & m) {
 				errmsg.append(m);
 			}
-			bool createPda(bool lr1);
+			bool createPda(bool lr1, bool lalr);
 			void createTable();
 			bool createSR();
 			void createErrorRecovery();
 		public:
 			Compiler(const CFG & c, const QMap<CFG::Symbol, QString> & s, const QMap<CFG::Symbol, QString> & i):cfg(c), symtypes(s), instances(i) {}
 			QSet<int> descendants(int state, int sym)const;
-			bool compile(bool lr1);
+			bool compile(bool lr1, bool lalr);
 			void print(QTextStream & ostream, const QString *options);
 			QString errors()const;
+			const QString & statistics()const {return stats;}
 	};
 	
 	QString Compiler::errors()const {
 		return errmsg.join("\n");
 	}
 	
-	bool Compiler::createPda(bool lr1) {
+	bool Compiler::createPda(bool lr1, bool lalr) {
 		{
 			const QSet<CFG::Symbol> s(cfg.startSymbols());
 			if(!s.size()) {
@@ -972,11 +1841,14 @@ namespace {
 				return false;
 			}
 		}
-		pda=cfg.toPDA(lr1);
+		QTime timer;
+		timer.start();
+		pda=lalr?cfg.toLR(lr1):cfg.toPDA(lr1);
 		if(!pda.isValid()) {
 			errmsg.append("Could not create push down automaton accepting supplied grammer.");
 			return false;
 		}
+		stats=QString("%1 automaton with %2 states built in %3 ms").arg(!lalr?"Legacy":lr1?"LR(1)":"LALR(1)").arg(pda.fa().count()).arg(timer.elapsed());
 		return true;
 	}
 	
@@ -999,7 +1871,7 @@ namespace {
 		
 		bool res(true);
 		for(int s(0); s<fa.count(); s++) {
-			for(int r=0; r<=cfg.terminalCount(); r++) {
+			for(int r=0; r<numSymbols; r++) {
 				QSet<PDA::Action> a(pda.lookAheadActions(FA::State(s), r));
 				const QSet<PDA::Shift> shifts(pda.nonActions(FA::State(s), r));
 				if(a.size()>1) {
@@ -1236,8 +2108,8 @@ namespace {
 		}
 	}
 	
-	bool Compiler::compile(bool lr1) {
-		if(!createPda(lr1))return false;
+	bool Compiler::compile(bool lr1, bool lalr) {
+		if(!createPda(lr1, lalr))return false;
 		createTable();
 		if(!createSR())return false;
 		createErrorRecovery();
@@ -1257,137 +2129,553 @@ namespace {
 		const QString opt_info_type(options[Parser::OptionInfoType]);
 		const QString opt_info_func(options[Parser::OptionInfoFunc]);
 		
+		const QString opt_parser_tables(options[Parser::OptionParserTables]);
+		const bool direct(options[Parser::OptionParserStyle]=="direct");
+		
 		const int numStates(pda.fa().count());
-		ostream<<
-			"namespace {\n"
-			"\tconst int pt[]={\n\t\t";
-		for(int s(0); s<numStates; s++) {
-			if(s)ostream<<",\n\t\t";
-			for(int c(0); c<numSymbols; c++) {
-				if(c)ostream<<", ";
-				ostream<<QString("%1").arg(table[s*numSymbols+c], 4);
-			}
-		}
-		ostream<<"\n\t};\n";
-		ostream<<"\n";
-		ostream<<"\tconst int sr[]={\n\t\t";
-		for(int s(0); s<numStates; s++) {
-			if(s)ostream<<",\n\t\t";
-			for(int t(0); t<numSymbols; t++) {
-				if(t)ostream<<", ";
-				ostream<<QString("%1").arg(sr[s*numSymbols+t], 4);
+		const int numTerminals(cfg.terminalCount());
+		ostream<<"namespace {\n";
+		if(direct) {
+			//the states are compiled into parse()
+		} else if(opt_parser_tables=="dense") {
+			printIntArray("pt", table, numSymbols, ostream);
+			ostream<<"\n";
+			printIntArray("sr", sr, numSymbols, ostream);
+			ostream<<
+				"\t\n"
+				"\tint ptAt(int state, int symbol) {\n"
+				"\t\treturn pt[state*"<<numSymbols<<"+symbol];\n"
+				"\t}\n"
+				"\t\n"
+				"\tint srAt(int state, int symbol) {\n"
+				"\t\treturn sr[state*"<<numSymbols<<"+symbol];\n"
+				"\t}\n";
+		} else {
+			//shifts on terminals and the gotos on nonterminals are packed apart, every
+			//goto that is read exists, so the most frequent target of a nonterminal
+			//may stand for all states without one
+			const int actionWidth(numTerminals+1);
+			const int numGotos(numSymbols-actionWidth);
+			QVector<int> actions(numStates*actionWidth);
+			QVector<int> gotos(numGotos*numStates);
+			for(int s(0); s<numStates; s++) {
+				for(int c(0); c<actionWidth; c++)actions[s*actionWidth+c]=table[s*numSymbols+c];
+				for(int g(0); g<numGotos; g++)gotos[g*numStates+s]=table[s*numSymbols+actionWidth+g];
 			}
+			printPackedRows("pt", packRows(actions, actionWidth, false), ostream);
+			printPackedRows("gt", packRows(gotos, numStates, true), ostream);
+			printPackedRows("sr", packRows(sr, numSymbols, false), ostream);
+			ostream<<
+				"\t\n"
+				"\ttemplate<typename B, typename D, typename E, typename C>\n"
+				"\tint lookup(const B *base, const D *defaults, const E *entries, const C *check, int row, int column) {\n"
+				"\t\tconst int i(base[row]+column);\n"
+				"\t\treturn check[i]==row?entries[i]:defaults[row];\n"
+				"\t}\n"
+				"\t\n"
+				"\tint ptAt(int state, int symbol) {\n"
+				"\t\tif(symbol>"<<numTerminals<<")return lookup(gtBase, gtDefault, gtEntry, gtCheck, symbol-"<<actionWidth<<", state);\n"
+				"\t\treturn lookup(ptBase, ptDefault, ptEntry, ptCheck, state, symbol);\n"
+				"\t}\n"
+				"\t\n"
+				"\tint srAt(int state, int symbol) {\n"
+				"\t\treturn lookup(srBase, srDefault, srEntry, srCheck, state, symbol);\n"
+				"\t}\n";
 		}
-		ostream<<"\n\t};\n";
 		ostream<<"\tconst QStringList tokenNames(QStringList()";
 		for(int i=0; i<cfg.terminalCount(); i++) {
 			ostream<<"<<\n\t\t\""<<cfg.toString(CFG::Symbol(i, true)).replace(QChar('\\'), "\\\\").replace(QChar('"'), "\\\"")<<"\"";
 		}
 		ostream<<"<<\n\t\t\"<EOF>\");\n";
+		//states, marks and values of the parser live in parallel arrays, the values
+		//are stored in place in slots as large as the largest type and the mark of
+		//an entry tells the type of its value
+		const bool info(opt_info_type.length());
+		const QString info_type(opt_class+"::"+opt_info_type);
+		QMap<QString, QList<int> > marksByType;
+		for(int i=0; i<numTerminals; i++) {
+			const QString t(symtypes.value(CFG::Symbol(i, true)));
+			if(t!="" && t!="void")marksByType[t].append(i);
+		}
+		for(int i=0; i<cfg.nonterminalCount(); i++) {
+			const QString t(symtypes.value(CFG::Symbol(i, false)));
+			if(t!="" && t!="void")marksByType[t].append(i+numTerminals+1);
+		}
+		QString slotSize("1");
+		for(QMap<QString, QList<int> >::const_iterator it(marksByType.begin()); it!=marksByType.end(); ++it) {
+			slotSize=QString("MaxSize<sizeof(%1), %2>::value").arg(it.key()).arg(slotSize);
+		}
+		ostream<<
+			"\t\n"
+			"\ttemplate<size_t A, size_t B>\n"
+			"\tstruct MaxSize {\n"
+			"\t\tenum {value=A>B?A:B};\n"
+			"\t};\n"
+			"\t\n"
+			"\tunion Slot {\n"
+			"\t\tchar data["<<slotSize<<"];\n"
+			"\t\tdouble alignDouble;\n"
+			"\t\tlong double alignLongDouble;\n"
+			"\t\tqint64 alignInt;\n"
+			"\t\tvoid *alignPointer;\n"
+			"\t};\n"
+			"\t\n"
+			"\ttemplate<typename T>\n"
+			"\tT & valueAt(Slot & slot) {\n"
+			"\t\treturn *reinterpret_cast<T *>(slot.data);\n"
+			"\t}\n"
+			"\t\n"
+			"\ttemplate<typename T>\n"
+			"\tvoid constructValue(Slot & slot, T & value) {\n"
+			"\t\tnew(slot.data) T(takeValue(value));\n"
+			"\t}\n"
+			"\t\n"
+			"\ttemplate<typename T>\n"
+			"\tvoid destroyValue(Slot & slot) {\n"
+			"\t\tvalueAt<T>(slot).~T();\n"
+			"\t}\n"
+			"\t\n"
+			"\tvoid destroyValue(int mark, Slot & slot) {\n"
+			"\t\tswitch(mark) {\n";
+		for(QMap<QString, QList<int> >::const_iterator it(marksByType.begin()); it!=marksByType.end(); ++it) {
+			foreach(int mark, it.value())ostream<<"\t\t\tcase "<<mark<<":\n";
+			ostream<<
+				"\t\t\t\tdestroyValue<"<<it.key()<<" >(slot);\n"
+				"\t\t\t\tbreak;\n";
+		}
+		ostream<<
+			"\t\t}\n"
+			"\t}\n"
+			"\t\n"
+			"\tvoid moveValue(int mark, Slot & from, Slot & to) {\n"
+			"\t\tswitch(mark) {\n";
+		for(QMap<QString, QList<int> >::const_iterator it(marksByType.begin()); it!=marksByType.end(); ++it) {
+			foreach(int mark, it.value())ostream<<"\t\t\tcase "<<mark<<":\n";
+			ostream<<
+				"\t\t\t\tconstructValue(to, valueAt<"<<it.key()<<" >(from));\n"
+				"\t\t\t\tdestroyValue<"<<it.key()<<" >(from);\n"
+				"\t\t\t\tbreak;\n";
+		}
+		ostream<<
+			"\t\t}\n"
+			"\t}\n"
+			"\t\n"
+			"\tvoid moveValue("<<opt_class<<"::"<<opt_tokenList<<"::Node *node, Slot & to) {\n"
+			"\t\tswitch(node->mark) {\n";
+		for(QMap<QString, QList<int> >::const_iterator it(marksByType.begin()); it!=marksByType.end(); ++it) {
+			foreach(int mark, it.value())ostream<<"\t\t\tcase "<<mark<<":\n";
+			ostream<<
+				"\t\t\t\tconstructValue(to, static_cast<NodeImpl<"<<it.key()<<" > *>(node)->value);\n"
+				"\t\t\t\tbreak;\n";
+		}
+		ostream<<
+			"\t\t}\n"
+			"\t}\n"
+			"\t\n"
+			"\tclass ParseStack {\n"
+			"\t\tprivate:\n"
+			"\t\t\ttypedef "<<opt_class<<"::"<<opt_tokenList<<"::Node Node;\n";
+		if(info)ostream<<"\t\t\ttypedef "<<info_type<<" Info;\n";
+		ostream<<
+			"\t\t\tenum {InitialDepth=64};\n"
+			"\t\t\tint *states;\n"
+			"\t\t\tint *marks;\n"
+			"\t\t\tSlot *slots;\n";
+		if(info)ostream<<"\t\t\tInfo *infos;\n";
+		ostream<<
+			"\t\t\tint capacity;\n"
+			"\t\t\tint depth;\n"
+			"\t\t\tParseStack(const ParseStack &);\n"
+			"\t\t\tParseStack & operator=(const ParseStack &);\n"
+			"\t\t\tvoid grow() {\n"
+			"\t\t\t\tconst int c(capacity*2);\n"
+			"\t\t\t\tint *s(new int[c]);\n"
+			"\t\t\t\tint *m(new int[c]);\n"
+			"\t\t\t\tSlot *v(new Slot[c]);\n";
+		if(info)ostream<<"\t\t\t\tInfo *in(new Info[c]);\n";
+		ostream<<
+			"\t\t\t\tfor(int i=0; i<depth; i++) {\n"
+			"\t\t\t\t\ts[i]=states[i];\n"
+			"\t\t\t\t\tm[i]=marks[i];\n"
+			"\t\t\t\t\tmoveValue(marks[i], slots[i], v[i]);\n";
+		if(info)ostream<<"\t\t\t\t\tin[i]=infos[i];\n";
+		ostream<<
+			"\t\t\t\t}\n"
+			"\t\t\t\tdelete[] states;\n"
+			"\t\t\t\tdelete[] marks;\n"
+			"\t\t\t\tdelete[] slots;\n";
+		if(info)ostream<<"\t\t\t\tdelete[] infos;\n";
+		ostream<<
+			"\t\t\t\tstates=s;\n"
+			"\t\t\t\tmarks=m;\n"
+			"\t\t\t\tslots=v;\n";
+		if(info)ostream<<"\t\t\t\tinfos=in;\n";
+		ostream<<
+			"\t\t\t\tcapacity=c;\n"
+			"\t\t\t}\n"
+			"\t\tpublic:\n"
+			"\t\t\tParseStack():states(new int[InitialDepth]), marks(new int[InitialDepth]), slots(new Slot[InitialDepth]), "<<(info?"infos(new Info[InitialDepth]), ":"")<<"capacity(InitialDepth), depth(0) {}\n"
+			"\t\t\t~ParseStack() {\n"
+			"\t\t\t\tfor(int i=0; i<depth; i++)destroyValue(marks[i], slots[i]);\n"
+			"\t\t\t\tdelete[] states;\n"
+			"\t\t\t\tdelete[] marks;\n"
+			"\t\t\t\tdelete[] slots;\n";
+		if(info)ostream<<"\t\t\t\tdelete[] infos;\n";
+		const QString infoParam(info?", const Info & info=Info()":"");
+		const QString infoArg(info?", info":"");
+		ostream<<
+			"\t\t\t}\n"
+			"\t\t\t//pushes an entry without a value\n"
+			"\t\t\tvoid push(int state, int mark"<<infoParam<<") {\n"
+			"\t\t\t\tif(depth==capacity)grow();\n"
+			"\t\t\t\tstates[depth]=state;\n"
+			"\t\t\t\tmarks[depth]=mark;\n";
+		if(info)ostream<<"\t\t\t\tinfos[depth]=info;\n";
+		ostream<<
+			"\t\t\t\t++depth;\n"
+			"\t\t\t}\n"
+			"\t\t\t//pushes an entry and moves the value into its slot\n"
+			"\t\t\ttemplate<typename T>\n"
+			"\t\t\tvoid pushValue(int state, int mark, T & value"<<infoParam<<") {\n"
+			"\t\t\t\tif(depth==capacity)grow();\n"
+			"\t\t\t\tconstructValue(slots[depth], value);\n"
+			"\t\t\t\tpush(state, mark"<<infoArg<<");\n"
+			"\t\t\t}\n"
+			"\t\t\t//pushes a token, its value is moved out of the node\n"
+			"\t\t\tvoid shift(int state, Node *node) {\n"
+			"\t\t\t\tif(depth==capacity)grow();\n"
+			"\t\t\t\tmoveValue(node, slots[depth]);\n"
+			"\t\t\t\tpush(state, node->mark"<<(info?", node->info":"")<<");\n"
+			"\t\t\t}\n"
+			"\t\t\tint state()const {return states[depth-1];}\n"
+			"\t\t\t//the value of the i-th entry from the top, starting at 1\n"
+			"\t\t\ttemplate<typename T>\n"
+			"\t\t\tT & value(int i) {return valueAt<T>(slots[depth-i]);}\n";
+		if(info)ostream<<"\t\t\tconst Info & info(int i)const {return infos[depth-i];}\n";
+		ostream<<
+			"\t\t\ttemplate<typename T>\n"
+			"\t\t\tvoid destroy(int i) {destroyValue<T>(slots[depth-i]);}\n"
+			"\t\t\t//drops the top n entries, their values have to be destroyed before\n"
+			"\t\t\tvoid pop(int n) {depth-=n;}\n"
+			"\t};\n";
 		ostream<<"}\n\n";
+		//the parser runs in its lexer state, which parseFile() and parseStream()
+		//construct with their input
 		ostream<<
 			"bool "<<opt_class<<"::"<<opt_parse<<"() {\n"
-			//"\t"<<opt_tokenList<<"Impl stack(this);\n"//_parser
-			"\t"<<opt_tokenList<<"Impl stack;\n"
-			"\tstack.prepend(new "<<opt_tokenList<<"::Node("<<pda.fa().start().id()<<(opt_info_type.length()?QString(", %1()").arg(opt_info_type):QString(""))<<"));\n"
-			//"\t"<<opt_lexer_state<<" lexerState(this);\n"//_parser
-			"\t"<<opt_lexer_state<<" lexerState;\n"
-			"\t"<<opt_tokenList<<"Impl & tokens=lexerState.list;\n";
+			"\t"<<opt_lexer_state<<" state;\n"
+			"\treturn state."<<opt_parse<<"(*this);\n"
+			"}\n"
+			"\n"
+			"bool "<<opt_class<<"::"<<opt_lexer_state<<"::"<<opt_parse<<"("<<opt_class<<" & parser) {\n"
+			"\tParseStack stack;\n"
+			"\tstack.push("<<pda.fa().start().id()<<", -1);\n"
+			"\t"<<opt_tokenList<<"Impl & tokens=list;\n";
 		if(opt_init.length()) {
-			ostream<<"\tthis->"<<opt_init<<"(tokens);\n";
+			ostream<<"\tparser."<<opt_init<<"(tokens);\n";
+		}
+		//a reduction builds the value of its left side from the slots of the right
+		//side and drops them, both styles indent these lines and add the goto
+		QVector<QStringList> reductions(pda.reduceActionCount());
+		QVector<int> reductionMarks(pda.reduceActionCount(), -1);
+		QVector<QString> reductionPushes(pda.reduceActionCount());
+		QVector<bool> reductionCalls(pda.reduceActionCount(), false);
+		for(int a=0; a<pda.reduceActionCount(); a++) {
+			QStringList & lines=reductions[a];
+			const PDA::Action pdaAction(pda.reduceAction_i(a));
+			const CFG::Production prod(pda.production(pdaAction));
+			if(prod.id()==cfg.count()) {
+				lines.append("return true;");
+				continue;
+			}
+			Q_ASSERT(prod.isValid());
+			const CFG::ProductionInfo & pinfo=cfg.productionInfo(prod);
+			lines.append("//"+cfg.toString(pinfo));
+			const CFG::Action & cfgAction=pinfo.action();
+			const QString rt(symtypes.value(CFG::Symbol(pinfo.leftSide(), false)));
+			const bool typed(rt!="" && rt!="void");
+			const int n(pinfo.size());
+			const int pivot(cfgAction.pivot());
+			const int nmark(pinfo.leftSide()+numTerminals+1);
+			if(info) {
+				lines.append("const "+info_type+" info"+(n?"(stack.info("+QString::number(n)+"))":"="+info_type+"()")+";");
+			}
+			//values referenced once are handed over as rvalues unless they are kept
+			//as the pivot
+			QMap<int, int> uses;
+			for(int i=0; i<cfgAction.count(); i++) {
+				const CFG::Arg & arg=cfgAction.arg(i);
+				if(arg.isReference() && !arg.isMetaReference())uses[arg.reference()]++;
+			}
+			QStringList args;
+			for(int i=0; i<cfgAction.count(); i++) {
+				const CFG::Arg & arg=cfgAction.arg(i);
+				if(arg.isReference()) {
+					const int ref(arg.reference());
+					if(arg.isMetaReference()) {
+						args.append(QString("stack.info(%1)").arg(n-ref+1));
+					} else {
+						const QString t(symtypes.value(pinfo.shift(ref-1).symbol()));
+						Q_ASSERT(t!="" && t!="void");
+						const QString v(QString("stack.value<%1 >(%2)").arg(t).arg(n-ref+1));
+						args.append(ref!=pivot && uses[ref]==1?"takeValue("+v+")":v);
+					}
+				} else {
+					args.append(arg.literal());
+				}
+			}
+			const QString call(cfgAction.function().size()?"parser."+cfgAction.function()+"("+args.join(", ")+")":QString());
+			reductionCalls[a]=call.length();
+			if(pivot) {
+				if(call.length())lines.append(call+";");
+				if(typed)lines.append(rt+" value(takeValue(stack.value<"+rt+" >("+QString::number(n-pivot+1)+")));");
+			} else if(typed) {
+				if(call.length()) {
+					lines.append(rt+" value("+call+");");
+				} else if(cfgAction.count()) {
+					lines.append(rt+" value("+args.join(", ")+");");
+				} else {
+					lines.append(rt+" value="+rt+"();");
+				}
+			} else if(call.length()) {
+				lines.append(call+";");
+			}
+			for(int i(n-1); i>=0; --i) {
+				const QString t(symtypes.value(pinfo.shift(i).symbol()));
+				if(t!="" && t!="void")lines.append(QString("stack.destroy<%1 >(%2);").arg(t).arg(n-i));
+			}
+			if(n)lines.append(QString("stack.pop(%1);").arg(n));
+			reductionMarks[a]=nmark;
+			reductionPushes[a]=QString(typed?"pushValue":"push")+"(%1, "+QString::number(nmark)+(typed?", value":"")+(info?", info":"")+");";
+		}
+		//the call of a shift action, its references count back from the symbol shifted
+		QStringList shiftCalls;
+		for(int a=0; a<pda.shiftActionCount(); a++) {
+			const PDA::Action pdaAction(pda.shiftAction(a));
+			const CFG::Production prod(pda.production(pdaAction));
+			Q_ASSERT(prod.isValid());
+			const int pmark(pda.mark(pdaAction));
+			Q_ASSERT(pmark>=0);
+			const CFG::ProductionInfo & pinfo=cfg.productionInfo(prod);
+			Q_ASSERT(pmark<pinfo.size());
+			const CFG::Action & cfgAction=pinfo.shift(pmark).action();
+			QStringList args;
+			for(int i=0; i<cfgAction.count(); i++) {
+				const CFG::Arg & arg=cfgAction.arg(i);
+				if(arg.isReference()) {
+					const int ref(arg.reference());
+					if(arg.isMetaReference()) {
+						args.append(QString("stack.info(%1)").arg(pmark-ref+2));
+					} else {
+						const QString t(symtypes.value(pinfo.shift(ref-1).symbol()));
+						Q_ASSERT(t!="" && t!="void");
+						args.append(QString("stack.value<%1 >(%2)").arg(t).arg(pmark-ref+2));
+					}
+				} else {
+					args.append(arg.literal());
+				}
+			}
+			shiftCalls.append("parser."+cfgAction.function()+"("+args.join(", ")+");");
+		}
+		if(direct) {
+			//every state is a label that reads the lookahead and jumps to the label of
+			//a reduction or to shiftN, which consumes the token before stateN. A shift
+			//action belongs to the state it leads to, so it runs at enterN, where the
+			//reductions go as well. A reduction goes to the state of its left side by a
+			//switch on the state it uncovers
+			QVector<int> actionOf(numStates, -1);
+			QVector<bool> byToken(numStates, false);
+			QVector<bool> byGoto(numStates, false);
+			QVector<bool> reduced(pda.reduceActionCount(), false);
+			for(int st(0); st<numStates; st++) {
+				for(int c(0); c<numSymbols; c++) {
+					const int a(sr[st*numSymbols+c]);
+					const int t(table[st*numSymbols+c]);
+					if(a>0) {
+						reduced[a-1]=true;
+						continue;
+					}
+					if(t<0)continue;
+					if(c>numTerminals) {
+						byGoto[t]=true;
+					} else {
+						byToken[t]=true;
+					}
+					if(a<0) {
+						Q_ASSERT(actionOf[t]<0 || actionOf[t]==-a-1);
+						actionOf[t]=-a-1;
+					}
+				}
+			}
+			//only a token with an instance can be put in front of the lookahead, any
+			//other unexpected token is dropped
+			QMap<int, CFG::Symbol> instanceOf;
+			for(QMap<CFG::Symbol, QString>::const_iterator it(instances.begin()); it!=instances.end(); ++it) {
+				instanceOf[it.key().hash()]=it.key();
+			}
+			ostream<<
+				"\t"<<opt_tokenList<<"::Node *node(0);\n"
+				"\tgoto state"<<pda.fa().start().id()<<";\n";
+			for(int st(0); st<numStates; st++) {
+				if(byToken[st]) {
+					ostream<<
+						"shift"<<st<<":\n"
+						"\ttokens.removeFirst();\n"
+						"\tstack.shift("<<st<<", node);\n"
+						"\tdeleteNode(&allocator, node);\n";
+				}
+				if(actionOf[st]>=0) {
+					if(byGoto[st])ostream<<"enter"<<st<<":\n";
+					ostream<<
+						"\t"<<shiftCalls[actionOf[st]]<<"\n"
+						"\tif(parser."<<opt_errorFlag<<"())return false;\n";
+				}
+				ostream<<
+					"state"<<st<<":\n"
+					"\twhile(tokens.isEmpty()) {\n"
+					"\t\tparser."<<opt_lex<<"(*this);\n"
+					"\t\tif(parser."<<opt_errorFlag<<"())return false;\n"
+					"\t}\n"
+					"\tnode=tokens.first();\n";
+				QMap<QString, QList<int> > casesByCode;
+				QMap<int, QList<int> > recoveries;
+				for(int c(0); c<=numTerminals; c++) {
+					const int a(sr[st*numSymbols+c]);
+					const int t(table[st*numSymbols+c]);
+					if(a>0) {
+						casesByCode[QString("goto reduce%1;").arg(a)].append(c);
+					} else if(t>=0) {
+						casesByCode[QString("goto shift%1;").arg(t)].append(c);
+					} else if(t<-1 && instanceOf.contains(-t-2)) {
+						recoveries[-t-2].append(c);
+					}
+				}
+				if(casesByCode.size()) {
+					ostream<<
+						"\tswitch(node->mark) {\n";
+					for(QMap<QString, QList<int> >::const_iterator it(casesByCode.begin()); it!=casesByCode.end(); ++it) {
+						foreach(int c, it.value())ostream<<"\t\tcase "<<c<<":\n";
+						ostream<<"\t\t\t"<<it.key()<<"\n";
+					}
+					ostream<<
+						"\t}\n";
+				}
+				ostream<<
+					"\tparser."<<opt_issue<<"(QString(\"Unexpected token:%1\").arg(::tokenNames.value(node->mark)));\n"
+					"\tif(parser."<<opt_errorFlag<<"())return false;\n";
+				if(recoveries.size()) {
+					ostream<<
+						"\tswitch(node->mark) {\n";
+					for(QMap<int, QList<int> >::const_iterator it(recoveries.begin()); it!=recoveries.end(); ++it) {
+						const CFG::Symbol instance(instanceOf[it.key()]);
+						foreach(int c, it.value())ostream<<"\t\tcase "<<c<<":\n";
+						ostream<<
+							"\t\t\ttokens.prepend(new(&allocator) NodeImpl<"<<symtypes[instance]<<" >("<<it.key()<<(info?QString(", %1()").arg(info_type):QString(""))<<", "<<instances[instance]<<"));\n"
+							"\t\t\tgoto state"<<st<<";\n";
+					}
+					ostream<<
+						"\t}\n";
+				}
+				ostream<<
+					"\tif(node->mark=="<<numTerminals<<")return false;\n"
+					"\ttokens.removeFirst();\n"
+					"\tdeleteNode(&allocator, node);\n"
+					"\tgoto state"<<st<<";\n";
+			}
+			for(int a=0; a<pda.reduceActionCount(); a++) {
+				if(!reduced[a])continue;
+				ostream<<
+					"reduce"<<(a+1)<<":\n"
+					"\t{\n";
+				foreach(const QString & line, reductions[a])ostream<<"\t\t"<<line<<"\n";
+				const int nmark(reductionMarks[a]);
+				if(nmark<0) {
+					ostream<<
+						"\t}\n";
+					continue;
+				}
+				if(reductionCalls[a])ostream<<"\t\tif(parser."<<opt_errorFlag<<"())return false;\n";
+				//the most frequent state of the left side is the default
+				QMap<int, QList<int> > uncovered;
+				for(int st(0); st<numStates; st++) {
+					const int t(table[st*numSymbols+nmark]);
+					if(t>=0)uncovered[t].append(st);
+				}
+				int common(-1);
+				for(QMap<int, QList<int> >::const_iterator it(uncovered.begin()); it!=uncovered.end(); ++it) {
+					if(common<0 || it.value().size()>uncovered[common].size())common=it.key();
+				}
+				Q_ASSERT(common>=0);
+				const QString push(reductionPushes[a]);
+				if(uncovered.size()==1) {
+					ostream<<
+						"\t\tstack."<<push.arg(common)<<"\n"
+						"\t\tgoto "<<(actionOf[common]>=0?"enter":"state")<<common<<";\n";
+				} else {
+					ostream<<
+						"\t\tswitch(stack.state()) {\n";
+					for(QMap<int, QList<int> >::const_iterator it(uncovered.begin()); it!=uncovered.end(); ++it) {
+						if(it.key()==common)continue;
+						foreach(int st, it.value())ostream<<"\t\t\tcase "<<st<<":\n";
+						ostream<<
+							"\t\t\t\tstack."<<push.arg(it.key())<<"\n"
+							"\t\t\t\tgoto "<<(actionOf[it.key()]>=0?"enter":"state")<<it.key()<<";\n";
+					}
+					ostream<<
+						"\t\t\tdefault:\n"
+						"\t\t\t\tstack."<<push.arg(common)<<"\n"
+						"\t\t\t\tgoto "<<(actionOf[common]>=0?"enter":"state")<<common<<";\n"
+						"\t\t}\n";
+				}
+				ostream<<
+					"\t}\n";
+			}
+			ostream<<
+				"}\n"
+				"\n";
+			return;
 		}
 		ostream<<
 			"\tbool done(false);\n"
-			//"\twhile("<<opt_lex<<"(lexerState)) {\n"
 			"\twhile(!done) {\n"
 			"\t\twhile(tokens.isEmpty()) {\n"
-			"\t\t\tthis->"<<opt_lex<<"(lexerState);\n"
-			"\t\t\tif(this->"<<opt_errorFlag<<"())return false;\n"
+			"\t\t\tparser."<<opt_lex<<"(*this);\n"
+			"\t\t\tif(parser."<<opt_errorFlag<<"())return false;\n"
 			"\t\t}\n"
 			"\t\twhile(!tokens.isEmpty()) {\n"
 			"\t\t\t"<<opt_tokenList<<"::Node *node(tokens.first());\n"
 			"\t\t\tconst int lasymbol(node->mark);\n"
-			"\t\t\tif(lasymbol=="<<cfg.terminalCount()<<")done=true;\n"
-			"\t\t\tconst int curstate(stack.first()->mark);\n"
-			"\t\t\tconst int act(lasymbol<"<<numSymbols<<"?sr[curstate*"<<numSymbols<<"+lasymbol]:0);\n"
+			"\t\t\tif(lasymbol=="<<numTerminals<<")done=true;\n"
+			"\t\t\tconst int curstate(stack.state());\n"
+			"\t\t\tint act(lasymbol<"<<numSymbols<<"?srAt(curstate, lasymbol):0);\n"
 			"\t\t\tif(act<=0) {\n"
-			"\t\t\t\tconst int nstate(pt[curstate*"<<numSymbols<<"+lasymbol]);\n"
+			"\t\t\t\tconst int nstate(ptAt(curstate, lasymbol));\n"
 			"\t\t\t\tif(nstate<0) {\n"
-			"\t\t\t\t\t"<<opt_issue<<"(QString(\"Unexpected token:%1\").arg(::tokenNames.value(lasymbol)));\n";
-			//"\t\t\t\t\treturn false;\n"
+			"\t\t\t\t\tparser."<<opt_issue<<"(QString(\"Unexpected token:%1\").arg(::tokenNames.value(lasymbol)));\n";
 		if(instances.size()) {
 			ostream<<
 				"\t\t\t\t\tswitch(-nstate) {\n";
 			for(QMap<CFG::Symbol, QString>::const_iterator it(instances.begin()); it!=instances.end(); ++it) {
 				ostream<<
 					"\t\t\t\t\t\tcase "<<(it.key().hash()+2)<<":\n"
-					"\t\t\t\t\t\t\ttokens.prepend(new NodeImpl<"<<symtypes[it.key()]<<" >("<<it.key().hash()<<(opt_info_type.length()?QString(", %1::%2()").arg(opt_class).arg(opt_info_type):QString(""))<<", "<<it.value()<<"));\n"
+					"\t\t\t\t\t\t\ttokens.prepend(new(&allocator) NodeImpl<"<<symtypes[it.key()]<<" >("<<it.key().hash()<<(info?QString(", %1()").arg(info_type):QString(""))<<", "<<it.value()<<"));\n"
 					"\t\t\t\t\t\t\tbreak;\n";
 			}
 			ostream<<
 				"\t\t\t\t\t\tdefault:\n"
 				"\t\t\t\t\t\t\ttokens.removeFirst();\n"
-				"\t\t\t\t\t\t\tdelete node;\n"
+				"\t\t\t\t\t\t\tdeleteNode(&allocator, node);\n"
 				"\t\t\t\t\t}\n";
 		} else {
 			ostream<<
 				"\t\t\t\t\ttokens.removeFirst();\n"
-				"\t\t\t\t\tdelete node;\n";
+				"\t\t\t\t\tdeleteNode(&allocator, node);\n";
 		}
 		ostream<<
 			"\t\t\t\t} else {\n"
 			"\t\t\t\t\ttokens.removeFirst();\n"
-			"\t\t\t\t\tstack.prepend(node);\n"
-			"\t\t\t\t\tnode->mark=nstate;\n";
-		if(pda.shiftActionCount()) {
-			ostream<<"\t\t\t\t\tif(act<0)switch(-act) {\n";
-			for(int a=0; a<pda.shiftActionCount(); a++) {
-				const PDA::Action pdaAction(pda.shiftAction(a));
-				const CFG::Production prod(pda.production(pdaAction));
-				Q_ASSERT(prod.isValid());
-				const int pmark(pda.mark(pdaAction));
-				Q_ASSERT(pmark>=0);
-				const CFG::ProductionInfo & pinfo=cfg.productionInfo(prod);
-				Q_ASSERT(pmark<pinfo.size());
-				const CFG::Action & cfgAction=pinfo.shift(pmark).action();
-				ostream<<
-					"\t\t\t\t\t\tcase "<<(a+1)<<":\n"
-					"\t\t\t\t\t\t{\n";
-				const int minref(cfgAction.minRef());
-				if(minref>0)for(int i(pmark); i>=minref-1; --i) {
-					const QString t(symtypes.value(pinfo.shift(i).symbol()));
-					if(t!="" && t!="void") ostream<<"\t\t\t\t\t\t\tNodeImpl<"<<t<<" > *n"<<(i+1)<<"((NodeImpl<"<<t<<" >*)";
-					else ostream<<"\t\t\t\t\t\t\t"<<opt_tokenList<<"::Node *n"<<(i+1)<<"(";
-					if(i==pmark)ostream<<"stack.first()";
-					else ostream<<"n"<<(i+2)<<"->ref";
-					ostream<<");\n";
-				}
-				ostream<<
-					"\t\t\t\t\t\t\tthis->"<<cfgAction.function()<<"(";
-				for(int i=0; i<cfgAction.count(); i++) {
-					if(i)ostream<<", ";
-					const CFG::Arg & arg=cfgAction.arg(i);
-					if(arg.isReference()) {
-						const int ref(arg.reference());
-						if(arg.isMetaReference()) {
-							ostream<<"n"<<ref<<"->info";
-						} else {
-							const QString t(symtypes.value(pinfo.shift(ref-1).symbol()));
-							Q_ASSERT(t!=""&&t!="void");
-							ostream<<"n"<<ref<<"->value"<<"/*"<<t<<"*/";
-						}
-					} else {
-						ostream<<arg.literal();
-					}
-				}
-				ostream<<
-					");\n"
-					"\t\t\t\t\t\t\tbreak;\n"
-					"\t\t\t\t\t\t}\n";
-			}
-			ostream<<"\t\t\t\t\t}\n";
-		}
-		ostream<<
+			"\t\t\t\t\tstack.shift(nstate, node);\n"
+			"\t\t\t\t\tdeleteNode(&allocator, node);\n"
 			"\t\t\t\t}\n"
 			"\t\t\t} else {\n"
 			"\t\t\t\tswitch(act) {\n";
@@ -1395,88 +2683,33 @@ namespace {
 			ostream<<
 				"\t\t\t\t\tcase "<<(a+1)<<":\n"
 				"\t\t\t\t\t{\n";
-			const PDA::Action pdaAction(pda.reduceAction_i(a));
-			const CFG::Production prod(pda.production(pdaAction));
-			if(prod.id()==cfg.count()) {
-				ostream<<
-					"\t\t\t\t\t\treturn true;\n"
-					"\t\t\t\t\t}\n";
-				continue;
-			}
-			Q_ASSERT(prod.isValid());
-			const CFG::ProductionInfo & pinfo=cfg.productionInfo(prod);
-			ostream<<"\t\t\t\t\t\t//"<<cfg.toString(pinfo)<<"\n";
-			const CFG::Action & cfgAction=pinfo.action();
-			const QString rt(symtypes.value(CFG::Symbol(pinfo.leftSide(), false)));
-			for(int i(pinfo.size()-1); i>=0; --i) {
-				const QString t(symtypes.value(pinfo.shift(i).symbol()));
-				if(t!="" && t!="void") ostream<<"\t\t\t\t\t\tNodeImpl<"<<t<<" > *n"<<(i+1)<<"((NodeImpl<"<<t<<" >*)";
-				else ostream<<"\t\t\t\t\t\t"<<opt_tokenList<<"::Node *n"<<(i+1)<<"(";
+			foreach(const QString & line, reductions[a])ostream<<"\t\t\t\t\t\t"<<line<<"\n";
+			const int nmark(reductionMarks[a]);
+			if(nmark>=0) {
 				ostream<<
-					"stack.first());\n"
-					"\t\t\t\t\t\tstack.removeFirst();\n";
-			}
-			const int pivot(cfgAction.pivot());
-			{
-				const int nmark(pinfo.leftSide()+cfg.terminalCount()+1);
-				ostream<<"\t\t\t\t\t\t";
-				if(!pivot) {
-					const QString metaInfoExp(opt_info_type.length()?(pinfo.size()?QString(", n1->info"):QString(", %1::%2()").arg(opt_class).arg(opt_info_type)):QString(""));
-					ostream<<"tokens.prepend(new ";
-					if(rt!="" && rt!="void") {
-						ostream<<"NodeImpl<"<<rt<<" >("<<nmark<<metaInfoExp;
-						if(cfgAction.function().size()||cfgAction.count())ostream<<", ";
-					} else {
-						ostream<<opt_tokenList<<"::Node("<<(pinfo.leftSide()+cfg.terminalCount()+1)<<metaInfoExp<<"));\n";
-					}
-				}
-				bool call(false);
-				if(cfgAction.function().size() || (!pivot && rt!="" && rt!="void" && cfgAction.count())) {
-					call=true;
-					if(cfgAction.function().size())ostream<<"this->"<<cfgAction.function()<<"(";
-					else ostream<<rt<<"(";
-					for(int i=0; i<cfgAction.count(); i++) {
-						if(i)ostream<<", ";
-						const CFG::Arg & arg=cfgAction.arg(i);
-						if(arg.isReference()) {
-							const int ref(arg.reference());
-							if(arg.isMetaReference()) {
-								ostream<<"n"<<ref<<"->info";
-							} else {
-								const QString t(symtypes.value(pinfo.shift(ref-1).symbol()));
-								Q_ASSERT(t!="" && t!="void");
-								ostream<<"n"<<ref<<"->value"<<"/*"<<t<<"*/";
-							}
-						} else {
-							ostream<<arg.literal();
-						}
-					}
-					ostream<<")";
-				}
-				if(!pivot) {
-					if(rt!="" && rt!="void") {
-						ostream<<"));\n";
-					} else {
-						if(call)ostream<<";\n";
-					}
-				} else {
-					if(cfgAction.function().size())ostream<<";\n\t\t\t\t\t\t";
-					ostream<<
-						"n"<<pivot<<"->mark="<<nmark<<";\n"
-						"\t\t\t\t\t\ttokens.prepend(n"<<pivot<<");\n";
-				}
-			}
-			for(int i(pinfo.size()-1); i>=0; --i) {
-				if((i+1)!=pivot)ostream<<"\t\t\t\t\t\tdelete n"<<(i+1)<<";\n";
+					"\t\t\t\t\t\tconst int uncovered(stack.state());\n"
+					"\t\t\t\t\t\tstack."<<reductionPushes[a].arg("ptAt(uncovered, "+QString::number(nmark)+")")<<"\n"
+					"\t\t\t\t\t\tact=srAt(uncovered, "<<nmark<<");\n"
+					"\t\t\t\t\t\tbreak;\n";
 			}
 			ostream<<
-				"\t\t\t\t\t\tbreak;\n"
 				"\t\t\t\t\t}\n";
 		}
 		ostream<<
 			"\t\t\t\t}\n"
-			"\t\t\t}\n"
-			"\t\t\tif("<<opt_errorFlag<<"())return false;\n"
+			"\t\t\t}\n";
+		if(shiftCalls.size()) {
+			ostream<<"\t\t\tif(act<0)switch(-act) {\n";
+			for(int a=0; a<shiftCalls.size(); a++) {
+				ostream<<
+					"\t\t\t\tcase "<<(a+1)<<":\n"
+					"\t\t\t\t\t"<<shiftCalls[a]<<"\n"
+					"\t\t\t\t\tbreak;\n";
+			}
+			ostream<<"\t\t\t}\n";
+		}
+		ostream<<
+			"\t\t\tif(parser."<<opt_errorFlag<<"())return false;\n"
 			"\t\t}\n"
 			"\t}\n"
 			"\treturn false;\n"
@@ -1500,7 +2733,9 @@ bool Parser::compileGrammer() {
 	options[OptionInfoFunc]=opt_info_func;*/
 	
 	Compiler compiler(cfg, symtypes, instances);
-	if(!compiler.compile(options[OptionLR1].length())) {
+	const bool res(compiler.compile(options[OptionLR1].length(), options[OptionLookAheads]=="lalr"));
+	stats=compiler.statistics();
+	if(!res) {
 		error(compiler.errors());
 		return false;
 	}
@@ -1533,6 +2768,10 @@ bool Parser::compile() {
 		"\n"
 		"#include \""<<hfile.fileName()<<"\"\n"
 		"#include <QStringList>\n"
+		"#include <new>\n";
+	if(options[OptionInput]=="buffer")ostream<<"#include <QVector>\n";
+	if(options[OptionParseFile].length() || options[OptionParseStream].length())ostream<<"#include <QFile>\n";
+	ostream<<
 		"\n";
 	
 	QMap<QString, int> startConditions;
@@ -57,7 +57,20 @@ class Parser {
 			OptionCharType=13,
 			OptionDump=14,
 			OptionLR1=15,
-			OptionMax=15
+			OptionEncoding=16,
+			OptionInput=17,
+			OptionRefill=18,
+			OptionTokenView=19,
+			OptionParseFile=20,
+			OptionParseStream=21,
+			OptionBufferSize=22,
+			OptionMaxTokenLength=23,
+			OptionNodeAllocator=24,
+			OptionParserTables=25,
+			OptionLexerStyle=26,
+			OptionParserStyle=27,
+			OptionLookAheads=28,
+			OptionMax=28
 		};
 		
 		//QString opt_next_char;
@@ -95,6 +108,7 @@ class Parser {
 		int pos;
 		QString errmsg;
 		QStringList issues;
+		QString stats;
 		
 		
 		REParser reparser;
@@ -165,6 +179,7 @@ class Parser {
 
 		void include(const QString & filename);
 		void setOption(const QString & option, const QString & value, int line);
+		void setOption(const QString & option, int value, int line);
 		void define(const QString & id, const QString & regexp, int line_id=-1, int line_re=-1);
 		void addPattern(const QSet<QString> & startConditions, const QString & regexp, const QString & func, int line=-1);
 		void addAnonPattern(const QSet<QString> & startConditions, const QString & regexp, const QString & inst, int line=-1);
@@ -211,6 +226,7 @@ class Parser {
 		Parser();
 		
 		const QString & lastError()const {return errmsg;}
+		const QString & statistics()const {return stats;}
 };
 
 #endif
@@ -22,59 +22,179 @@
 
 #include <QString>
 #include <QVector>
+#include <QMutex>
+#include <QMutexLocker>
 
 #include "REParser_gen.h"
 #include "utils.h"
 #include "Recorder.h"
+#include "CharClasses.h"
 
 namespace {
 	
-	bool testForClass(QChar ch, REParser::CharClass cl) {
-		switch(cl) {
-			case REParser::Digit:
-				return ch.isDigit();
-			case REParser::NonDigit:
-				return !ch.isDigit();
-			case REParser::Whitespace:
-				return ch.isSpace();
-			case REParser::NonWhitespace:
-				return !ch.isSpace();
-			case REParser::WordChar:
-				return ch.isLetterOrNumber()||ch.isMark()||ch==QChar('_');
-			case REParser::NonWordChar:
-				return !ch.isLetterOrNumber() && !ch.isMark() && ch!=QChar('_');
+	FA::StatePair unite(FA::Builder & nfa, const FA::StatePair & p1, const FA::StatePair & p2) {
+		const FA::State f(nfa.addState());
+		const FA::State t(nfa.addState());
+		nfa.addETransition(f, p1.first);
+		nfa.addETransition(f, p2.first);
+		nfa.addETransition(p1.second, t);
+		nfa.addETransition(p2.second, t);
+		return FA::StatePair(f, t);
+	}
+	
+	//the default encoding splits every character into 7 bit chunks, lowest first;
+	//every chunk but the last one carries the bit 128
+	FA::StatePair chunkedRange(FA::Builder & nfa, int c1, int c2) {
+		int r1(c1);
+		int r2(c2);
+		
+		int l1(r1&127);
+		int l2(r2&127);
+		
+		r1=r1>>7;
+		r2=r2>>7;
+		
+		if(!r1 && !r2) {
+			const FA::State f(nfa.addState());
+			const FA::State t(nfa.addState());
+			nfa.addTransition(f, FA::Range(FA::Symbol(l1), FA::Symbol(l2+1)), t);
+			return FA::StatePair(f, t);
+		} else if(r1==r2) {
+			const FA::State f(nfa.addState());
+			const FA::State t(nfa.addState());
+			nfa.addTransition(f, FA::Range(FA::Symbol(l1+128), FA::Symbol(l2+128+1)), t);
+			FA::StatePair p(chunkedRange(nfa, r1, r2));
+			nfa.addETransition(t, p.first);
+			return FA::StatePair(f, p.second);
+		} else {
+			Q_ASSERT(r1<r2);
+			FA::StatePair p1(chunkedRange(nfa, c1, (r1<<7)+127));
+			FA::StatePair p2(chunkedRange(nfa, (r2<<7), c2));
+			FA::StatePair res(unite(nfa, p1, p2));
+			if((r2-r1)>1) {
+				p1=chunkedRange(nfa, r1+1, r2-1);
+				const FA::State f(nfa.addState());
+				const FA::State t(nfa.addState());
+				nfa.addTransition(f, FA::Range(FA::Symbol(128), FA::Symbol(256)), t);
+				nfa.addETransition(t, p1.first);
+				p2=FA::StatePair(f, p1.second);
+				res=unite(nfa, res, p2);
+			}
+			return res;
 		}
-		return false;
 	}
 	
-	FA facache[6];
+	int utf8Encode(int c, uchar *b) {
+		if(c<0x80) {
+			b[0]=c;
+			return 1;
+		} else if(c<0x800) {
+			b[0]=0xC0|(c>>6);
+			b[1]=0x80|(c&0x3F);
+			return 2;
+		} else if(c<0x10000) {
+			b[0]=0xE0|(c>>12);
+			b[1]=0x80|((c>>6)&0x3F);
+			b[2]=0x80|(c&0x3F);
+			return 3;
+		}
+		b[0]=0xF0|(c>>18);
+		b[1]=0x80|((c>>12)&0x3F);
+		b[2]=0x80|((c>>6)&0x3F);
+		b[3]=0x80|(c&0x3F);
+		return 4;
+	}
 	
-	FA faForCharClass(REParser::CharClass cl) {
-		if(facache[cl].count())return facache[cl];
-		bool m(false);
-		FA fa;
-		FA::State start(fa.addState());
-		FA::State end(fa.addState());
-		int blockStart(-1);
-		for(int i=1; i<0xFFFF; i++) {
-			const QChar ch(i);
-			const bool d(i<0xFFFE?testForClass(ch, cl):false);
-			if(d!=m) {
-				if(d) {
-					blockStart=i;
-				} else {
-					FA::State s1(fa.addState());
-					FA::State s2(fa.addState());
-					fa.addTransition(s1, FA::Range(FA::Symbol(blockStart), FA::Symbol(i)), s2);
-					fa.addETransition(start, s1);
-					fa.addETransition(s2, end);
-				}
-				m=d;
+	//splits a code point range into sequences of byte ranges, where each sequence covers
+	//code points of one encoded length that differ in the last bytes only; surrogates are skipped
+	void utf8Sequences(int lo, int hi, QList<QVector<FA::Range> > & res) {
+		hi=qMin(hi, 0x10FFFF);
+		if(lo<0xD800 && hi>0xDFFF) {
+			utf8Sequences(lo, 0xD7FF, res);
+			utf8Sequences(0xE000, hi, res);
+			return;
+		}
+		if(lo>=0xD800 && lo<=0xDFFF)lo=0xE000;
+		if(hi>=0xD800 && hi<=0xDFFF)hi=0xD7FF;
+		if(lo>hi)return;
+		static const int limits[3]={0x7F, 0x7FF, 0xFFFF};
+		for(int i=0; i<3; i++) {
+			if(lo<=limits[i] && hi>limits[i]) {
+				utf8Sequences(lo, limits[i], res);
+				utf8Sequences(limits[i]+1, hi, res);
+				return;
+			}
+		}
+		for(int i=1; i<4; i++) {
+			const int m((1<<(6*i))-1);
+			if((lo&~m)==(hi&~m))continue;
+			if(lo&m) {
+				utf8Sequences(lo, lo|m, res);
+				utf8Sequences((lo|m)+1, hi, res);
+				return;
 			}
+			if((hi&m)!=m) {
+				utf8Sequences(lo, (hi&~m)-1, res);
+				utf8Sequences(hi&~m, hi, res);
+				return;
+			}
+		}
+		uchar b1[4];
+		uchar b2[4];
+		const int n(utf8Encode(lo, b1));
+		utf8Encode(hi, b2);
+		QVector<FA::Range> seq;
+		for(int i=0; i<n; i++) {
+			seq.append(FA::Range(FA::Symbol(b1[i]), FA::Symbol(b2[i]+1)));
+		}
+		res.append(seq);
+	}
+	
+	FA::StatePair utf8Range(FA::Builder & nfa, int c1, int c2) {
+		QList<QVector<FA::Range> > seqs;
+		utf8Sequences(c1, c2, seqs);
+		const FA::State f(nfa.addState());
+		const FA::State t(nfa.addState());
+		foreach(const QVector<FA::Range> & seq, seqs) {
+			FA::State cur(nfa.addState());
+			nfa.addETransition(f, cur);
+			for(int i=0; i<seq.size(); i++) {
+				const FA::State to(i+1<seq.size()?nfa.addState():t);
+				nfa.addTransition(cur, seq[i], to);
+				cur=to;
+			}
+		}
+		return FA::StatePair(f, t);
+	}
+	
+	FA::StatePair encodeRange(FA::Builder & nfa, int c1, int c2, REParser::Encoding encoding) {
+		if(encoding==REParser::Utf8)return utf8Range(nfa, c1, c2);
+		return chunkedRange(nfa, c1, c2);
+	}
+	
+	QMutex facacheMutex;
+	FA facache[2][6];
+	
+	//the classes are built from the generated tables on first use
+	FA faForCharClass(REParser::CharClass cl, REParser::Encoding encoding) {
+		QMutexLocker locker(&facacheMutex);
+		FA & cached=facache[encoding][cl];
+		if(cached.count())return cached;
+		FA::Builder fa;
+		const FA::State start(fa.addState());
+		const FA::State end(fa.addState());
+		const CharClasses::Range *r(CharClasses::ranges[cl]);
+		const int n(CharClasses::sizes[cl]);
+		for(int i=0; i<n; i++) {
+			//UTF-16 code units only reach \uFFFF, the classes keep to the BMP there
+			if(encoding!=REParser::Utf8 && r[i].from>0xFFFF)break;
+			const FA::StatePair p(encodeRange(fa, r[i].from, r[i].to-1, encoding));
+			fa.addETransition(start, p.first);
+			fa.addETransition(p.second, end);
 		}
 		fa.setStart(start);
 		fa.addMark(end, FA::Mark(0));
-		return facache[cl]=fa.deterministic();
+		return cached=fa.finalize().deterministic().minimal();
 	}
 	
 }
@@ -106,6 +226,11 @@ void REParser::endCharacterClass(const QString &, TokenList & q) {
 
 void REParser::pushCharacter(const QString & token, TokenList & q) {
 	QString s(qpg::unescape(token));
+	if(s.length()==2) {
+		Q_ASSERT(s.at(0).isHighSurrogate() && s.at(1).isLowSurrogate());
+		q.appendCHARACTER(QChar::surrogateToUcs4(s.at(0).unicode(), s.at(1).unicode()));
+		return;
+	}
 	Q_ASSERT(s.length()==1);
 	q.appendCHARACTER(s.at(0).unicode());
 }
@@ -151,48 +276,18 @@ FA::StatePair REParser::reunion(const FA::StatePair & p1, const FA::StatePair &
 }
 
 FA::StatePair REParser::reunion_impl(const FA::StatePair & p1, const FA::StatePair & p2, int rid) {
-	const FA::State f(fa.addState());
-	const FA::State t(fa.addState());
-	fa.addETransition(f, p1.first);
-	fa.addETransition(f, p2.first);
-	fa.addETransition(p1.second, t);
-	fa.addETransition(p2.second, t);
+	const FA::State f(nfa.addState());
+	const FA::State t(nfa.addState());
+	nfa.addETransition(f, p1.first);
+	nfa.addETransition(f, p2.first);
+	nfa.addETransition(p1.second, t);
+	nfa.addETransition(p2.second, t);
 	return FA::StatePair(f, t, rid);
 }
 
 FA::StatePair REParser::recomplement(const FA::StatePair & p1, const FA::StatePair & p2) {
-	FA fa(this->fa);
-	
-	{
-		const FA::State f(fa.addState());
-		const FA::State t(fa.addState());
-		fa.addETransition(f, p1.first);
-		fa.addETransition(f, p2.first);
-		fa.addETransition(p1.second, t);
-		fa.addETransition(p2.second, t);
-		
-		fa.setStart(f);
-		fa.addMark(p1.second, FA::Mark(1));
-		fa.addMark(p2.second, FA::Mark(2));
-	}
-	
-	fa=fa.deterministic();
-	{
-		const FA::State r(fa.addState());
-		
-		for(int i=0; i<fa.count(); i++) {
-			QSet<FA::Mark> m(fa.marks(FA::State(i)));
-			if(m.size()!=1)continue;
-			if((*(m.begin()))!=FA::Mark(1))continue;
-			fa.addETransition(FA::State(i), r);
-		}
-		fa.removeAllMarks();
-		fa.addMark(r, FA::Mark(0));
-	}
-	
-	fa=fa.deterministic();
-	
-	FA::StatePair res(this->fa.insert(fa, false));
+	const FA fa(FA::difference(nfa.extract(p1).deterministic(), nfa.extract(p2).deterministic()));
+	FA::StatePair res(nfa.insert(fa, false));
 	
 	if(rec) {
 		res.rid=rec->uniqueId();
@@ -202,8 +297,8 @@ FA::StatePair REParser::recomplement(const FA::StatePair & p1, const FA::StatePa
 }
 
 FA::StatePair REParser::reconcat_impl(const FA::StatePair & p1, const FA::StatePair & p2, int rid) {
-	Q_ASSERT(p1.second.isValid() && p1.second.id()<fa.count());
-	fa.addETransition(p1.second, p2.first);
+	Q_ASSERT(p1.second.isValid() && p1.second.id()<nfa.count());
+	nfa.addETransition(p1.second, p2.first);
 	return FA::StatePair(p1.first, p2.second, rid);
 }
 
@@ -217,12 +312,12 @@ FA::StatePair REParser::reconcat(const FA::StatePair & p1, const FA::StatePair &
 }
 
 FA::StatePair REParser::reclosure_impl(const FA::StatePair & p, int rid) {
-	const FA::State f(fa.addState());
-	const FA::State t(fa.addState());
-	fa.addETransition(f, p.first);
-	fa.addETransition(f, t);
-	fa.addETransition(p.second, t);
-	fa.addETransition(t, p.first);
+	const FA::State f(nfa.addState());
+	const FA::State t(nfa.addState());
+	nfa.addETransition(f, p.first);
+	nfa.addETransition(f, t);
+	nfa.addETransition(p.second, t);
+	nfa.addETransition(t, p.first);
 	return FA::StatePair(f, t, rid);
 }
 
@@ -236,11 +331,11 @@ FA::StatePair REParser::reclosure(const FA::StatePair & p) {
 }
 
 FA::StatePair REParser::repclosure(const FA::StatePair & p) {
-	const FA::State f(fa.addState());
-	const FA::State t(fa.addState());
-	fa.addETransition(f, p.first);
-	fa.addETransition(p.second, t);
-	fa.addETransition(t, p.first);
+	const FA::State f(nfa.addState());
+	const FA::State t(nfa.addState());
+	nfa.addETransition(f, p.first);
+	nfa.addETransition(p.second, t);
+	nfa.addETransition(t, p.first);
 	int rid(-1);
 	if(rec) {
 		rid=rec->uniqueId();
@@ -250,11 +345,11 @@ FA::StatePair REParser::repclosure(const FA::StatePair & p) {
 }
 
 FA::StatePair REParser::reoptional_impl(const FA::StatePair & p, int rid) {
-	const FA::State f(fa.addState());
-	const FA::State t(fa.addState());
-	fa.addETransition(f, p.first);
-	fa.addETransition(f, t);
-	fa.addETransition(p.second, t);
+	const FA::State f(nfa.addState());
+	const FA::State t(nfa.addState());
+	nfa.addETransition(f, p.first);
+	nfa.addETransition(f, t);
+	nfa.addETransition(p.second, t);
 	return FA::StatePair(f, t, rid);
 }
 
@@ -268,47 +363,47 @@ FA::StatePair REParser::reoptional(const FA::StatePair & p) {
 }
 
 FA::StatePair REParser::quantified(const FA::StatePair & p, const Quantifier & q) {
-	FA dfa;
-	{
-		FA fa(this->fa);
-		fa.removeAllMarks();
-		fa.setStart(p.first);
-		fa.addMark(p.second, 0);
-		dfa=fa.deterministic();
-	}
-	QList<FA::StatePair> pairs;
+	//the body is extracted and minimized once, every repetition shares that copy
+	const FA body(nfa.extract(p).deterministic().minimal());
+	const FA::State f(nfa.addState());
+	const FA::State t(nfa.addState());
+	FA::State cur(f);
 	int i(0);
 	for(; i<q.min; ++i) {
-		pairs.append(fa.insert(dfa, false));
+		const FA::StatePair c(nfa.insert(body, false));
+		nfa.addETransition(cur, c.first);
+		cur=c.second;
 	}
 	if(q.max>0) {
 		for(; i<q.max; ++i) {
-			pairs.append(reoptional_impl(fa.insert(dfa, false), -1));
+			const FA::StatePair c(nfa.insert(body, false));
+			nfa.addETransition(cur, t);
+			nfa.addETransition(cur, c.first);
+			cur=c.second;
 		}
 	} else {
-		pairs.append(reclosure_impl(fa.insert(dfa, false), -1));
+		const FA::StatePair c(nfa.insert(body, false));
+		nfa.addETransition(cur, c.first);
+		nfa.addETransition(c.second, c.first);
+		nfa.addETransition(c.second, t);
 	}
-	for(i=1; i<pairs.size(); i++) {
-		pairs[0]=reconcat_impl(pairs[0], pairs[i], -1);
-	}
-	Q_ASSERT(pairs.size());
+	nfa.addETransition(cur, t);
 	int rid(-1);
 	if(rec) {
 		rid=rec->uniqueId();
 		rec->addLine(QString("FA::StatePair p%1(reparser.quantified(p%2, REParser::Quantifier(%3)));").arg(rid).arg(p.rid).arg(q.max>=0?QString("%1,%2").arg(q.min).arg(q.max):QString().setNum(q.min)));
 	}
-	pairs[0].rid=rid;
-	return pairs[0];
+	return FA::StatePair(f, t, rid);
 }
 
-FA::StatePair REParser::rechar(ushort c) {
+FA::StatePair REParser::rechar(int c) {
 	return rerange(c, c);
 }
 
 
-FA::StatePair REParser::rerange(ushort c1, ushort c2) {
+FA::StatePair REParser::rerange(int c1, int c2) {
 	if(c2<c1) {
-		error(QString("Character range is out of order: %1 - %2").arg((int)c1).arg((int)c2));
+		error(QString("Character range is out of order: %1 - %2").arg(c1).arg(c2));
 		return FA::StatePair();
 	}
 
@@ -320,45 +415,9 @@ FA::StatePair REParser::rerange(ushort c1, ushort c2) {
 	return rerange_impl(c1, c2, rid);
 }
 	
-FA::StatePair REParser::rerange_impl(ushort c1, ushort c2, int rid) {
-	int r1(c1);
-	int r2(c2);
-	
-	int l1(r1&127);
-	int l2(r2&127);
-	
-	r1=r1>>7;
-	r2=r2>>7;
-	
-	if(!r1 && !r2) {
-		const FA::State f(fa.addState());
-		const FA::State t(fa.addState());
-		fa.addTransition(f, FA::Range(FA::Symbol(l1), FA::Symbol(l2+1)), t);
-		return FA::StatePair(f, t, rid);
-	} else if(r1==r2) {
-		const FA::State f(fa.addState());
-		const FA::State t(fa.addState());
-		fa.addTransition(f, FA::Range(FA::Symbol(l1+128), FA::Symbol(l2+128+1)), t);
-		FA::StatePair p(rerange_impl((ushort)r1, (ushort)r2, rid));
-		fa.addETransition(t, p.first);
-		return FA::StatePair(f, p.second, rid);
-	} else {
-		Q_ASSERT(r1<r2);
-		FA::StatePair p1(rerange_impl(c1, (r1<<7)+127, rid));
-		FA::StatePair p2(rerange_impl((r2<<7), c2, rid));
-		FA::StatePair res(reunion_impl(p1, p2, rid));
-		if((r2-r1)>1) {
-			p1=rerange_impl(r1+1, r2-1, rid);
-			const FA::State f(fa.addState());
-			const FA::State t(fa.addState());
-			fa.addTransition(f, FA::Range(FA::Symbol(128), FA::Symbol(256)), t);
-			fa.addETransition(t, p1.first);
-			p2=FA::StatePair(f, p1.second);
-			res=reunion_impl(res, p2, rid);
-		}
-		return res;
-	}
-	
+FA::StatePair REParser::rerange_impl(int c1, int c2, int rid) {
+	const FA::StatePair p(encodeRange(nfa, c1, c2, encoding));
+	return FA::StatePair(p.first, p.second, rid);
 }
 
 FA::StatePair REParser::reclass(bool invert, const FA::StatePair & p) {
@@ -367,7 +426,7 @@ FA::StatePair REParser::reclass(bool invert, const FA::StatePair & p) {
 }
 
 FA::StatePair REParser::reclass(CharClass c) {
-	return fa.insert(faForCharClass(c), false);
+	return nfa.insert(faForCharClass(c, encoding), false);
 }
 
 FA::StatePair REParser::reinsert(const QString & id) {
@@ -376,58 +435,43 @@ FA::StatePair REParser::reinsert(const QString & id) {
 		return FA::StatePair();
 	}
 	if(id==".")dot=true;
-	FA::State start(fa.addState());
-	FA::State end(fa.addState());
-	const int offset(end.id()+1);
-	const FA & src=defs[id];
-	Q_ASSERT(src.isDeterministic());
-	const int n(src.count());
-	const int nr(src.rangeCount());
-	for(int i=0; i<n; i++) {
-		FA::State s(fa.addState());
-		if(src.start()==FA::State(i)) {
-			fa.addETransition(start, s);
-		}
-		if(src.marks(FA::State(i)).size()) {
-			fa.addETransition(s, end);
-		}
-	}
-	for(int i=0; i<n; i++) {
-		const FA::State st_src(i);
-		const FA::State st_fa(i+offset);
-		for(int r=0; r<nr; r++) {
-			FA::Range range(src.range(r));
-			const FA::State dst(src.transition(st_src, range.from));
-			if(!dst.isValid())continue;
-			fa.addTransition(st_fa, range, FA::State(dst.id()+offset));
-		}
-/*		const QSet<FA::State> eset(src.eTransitions(st_src));
-		foreach(FA::State dst, eset) {
-			fa.addETransition(st_fa, FA::State(dst.id()+offset));
-		}*/
-	}
+	const FA::StatePair p(nfa.insert(defs[id], false));
 	
 	int rid(-1);
 	if(rec) {
 		rid=rec->uniqueId();
 		rec->addLine(QString("FA::StatePair p%1(reparser.reinsert(\"%2\"));").arg(rid).arg(id));
 	}
-	return FA::StatePair(start, end, rid);
+	return FA::StatePair(p.first, p.second, rid);
 }
 
 FA::StatePair REParser::restring(const QString & s) {
-	const FA::State start(fa.addState());
+	const FA::State start(nfa.addState());
 	FA::State cur(start);
 	const int n(s.length());
 	Q_ASSERT(n);
 	for(int i=0; i<n; i++) {
 		int c(s.at(i).unicode());
+		if(encoding==Utf8) {
+			if(s.at(i).isHighSurrogate() && i+1<n && s.at(i+1).isLowSurrogate()) {
+				c=QChar::surrogateToUcs4(s.at(i).unicode(), s.at(i+1).unicode());
+				i++;
+			}
+			uchar b[4];
+			const int nb(utf8Encode(c, b));
+			for(int k=0; k<nb; k++) {
+				FA::State to(nfa.addState());
+				nfa.addTransition(cur, FA::Range(FA::Symbol(b[k])), to);
+				cur=to;
+			}
+			continue;
+		}
 		do {
 			int ec(c&127);
 			c=c>>7;
 			if(c)ec|=128;
-			FA::State to(fa.addState());
-			fa.addTransition(cur, FA::Range(FA::Symbol(ec), FA::Symbol(ec+1)), to);
+			FA::State to(nfa.addState());
+			nfa.addTransition(cur, FA::Range(FA::Symbol(ec), FA::Symbol(ec+1)), to);
 			cur=to;
 		} while(c);
 	}
@@ -440,8 +484,10 @@ FA::StatePair REParser::restring(const QString & s) {
 }
 
 void REParser::convert(const FA::StatePair & p) {
-	fa.setStart(p.first);
-	fa.addMark(p.second, FA::Mark(endmark));
+	nfa.setStart(p.first);
+	nfa.addMark(p.second, FA::Mark(endmark));
+	fa=nfa.finalize();
+	nfa=FA::Builder();
 	//fa.print();
 	fa=fa.deterministic();
 	//fa.print();
@@ -460,16 +506,19 @@ bool REParser::parse(const QString & str, int em) {
 	errmsg="";
 	issuemsg="";
 	fa=FA();
+	nfa=FA::Builder();
 	buf=str;
 	currentchar=-1;
 	pos=0;
 	endmark=em;
 	if(!parse()) {
 		fa=FA();
+		nfa=FA::Builder();
 		return false;
 	}
 	if(issuemsg.length()) {
 		fa=FA();
+		nfa=FA::Builder();
 		return false;
 	}
 	return true;
@@ -480,33 +529,9 @@ void REParser::defineAs(const QString & id) {
 	if(id==".") {
 		Q_ASSERT(!dot);
 		dot=true;
-		FA fa_dot;
-		const FA::State startSate(fa_dot.addState());
-		const FA::State finalState(fa_dot.addState());
-		fa_dot.setStart(startSate);
 		Q_ASSERT(defs.contains("."));
-		FA::StatePair p(fa_dot.insert(defs["."]));
-		fa_dot.addETransition(startSate, p.first);
-		fa_dot.addETransition(p.second, finalState);
-		fa_dot.addMark(p.second, 0);
 		for(int i=0; i<6; i++) {
-			FA fa(fa_dot);
-			p=fa.insert(faForCharClass((CharClass)i));
-			fa.addETransition(startSate, p.first);
-			fa.addETransition(p.second, finalState);
-			fa.addMark(p.second, 1);
-			fa=fa.deterministic();
-			QVector<FA::State> finals;
-			for(int s(0); s<fa.count(); ++s) {
-				const FA::State curState(s);
-				if(fa.marks(curState).size()==2)finals.append(curState);
-			}
-			fa.removeAllMarks();
-			foreach(FA::State s, finals) {
-				fa.addMark(s, 0);
-			}
-			fa=fa.minimal();
-			predefs[i]=fa;
+			predefs[i]=FA::intersection(defs["."], faForCharClass((CharClass)i, encoding)).minimal();
 		}
 	}
 	defs[id]=fa;
@@ -524,27 +549,29 @@ const QString & REParser::lastError()const {
 	return errmsg;
 }
 
-REParser::REParser():rec(0) {
+REParser::REParser():rec(0), encoding(Utf16) {
 	clear();
-	for(int i=0; i<6; i++) {
-		predefs[i]=faForCharClass((CharClass)i);
-	}
 }
 
 void REParser::setRecorder(Recorder *r) {
 	rec=r;
 }
 
+void REParser::setEncoding(Encoding e) {
+	encoding=e;
+}
+
 void REParser::clear() {
 	defs.clear();
-	const FA::StatePair p(rerange(0, 65533));
-	fa.setStart(p.first);
-	fa.addMark(p.second, FA::Mark(0));
-	fa=fa.deterministic();
+	const FA::StatePair p(rerange(0, encoding==Utf8?0x10FFFF:65533));
+	nfa.setStart(p.first);
+	nfa.addMark(p.second, FA::Mark(0));
+	fa=nfa.finalize().deterministic();
 	fa=fa.minimal();
 	defs["."]=fa;
 	dot=false;
 	fa=FA();
+	nfa=FA::Builder();
 }
 
 //EOF
@@ -37,6 +37,8 @@ class REParser {
 		typedef QChar Char;
 		typedef FA::StatePair StatePair;
 		enum CharClass {Digit=0, NonDigit=1, Whitespace=2, NonWhitespace=3, WordChar=4, NonWordChar=5};
+		//Utf16 feeds the characters to the lexer in 7 bit chunks, Utf8 expects the input as bytes
+		enum Encoding {Utf16=0, Utf8=1};
 		struct Quantifier {
 			int min;
 			int max;
@@ -53,11 +55,13 @@ class REParser {
 private:
 		Recorder *rec;
 		
+		FA::Builder nfa;
 		FA fa;
 		QMap<QString, FA> defs;
 		bool dot;
 		FA predefs[6];
 		int endmark;
+		Encoding encoding;
 		
 		QString buf;
 		int pos;
@@ -91,9 +95,9 @@ private:
 		FA::StatePair reoptional_impl(const FA::StatePair & p, int rid);
 		FA::StatePair reoptional(const FA::StatePair & p);
 		FA::StatePair quantified(const FA::StatePair & p, const Quantifier & q);
-		FA::StatePair rechar(ushort c);
-		FA::StatePair rerange(ushort c1, ushort c2);
-		FA::StatePair rerange_impl(ushort c1, ushort c2, int rid);
+		FA::StatePair rechar(int c);
+		FA::StatePair rerange(int c1, int c2);
+		FA::StatePair rerange_impl(int c1, int c2, int rid);
 		FA::StatePair reclass(bool invert, const FA::StatePair & p);
 		FA::StatePair reclass(CharClass c);
 		void convert(const FA::StatePair & p);
@@ -111,6 +115,7 @@ private:
 		bool isDefined(const QString & id)const;
 		const QString & lastError()const;
 		void clear();
+		void setEncoding(Encoding e);
 };
 
 #endif
@@ -21,6 +21,7 @@
 #include "cfg.h"
 
 #include <QLinkedList>
+#include <QBitArray>
 #include <QStringList>
 #include "fa.h"
 #include "pda.h"
@@ -357,12 +358,12 @@ PDA CFG::toPDA(bool lr1)const {
 	for(int pass(0); pass<2; ++pass) {
 		bool ok(true);
 		
-		FA fa;
+		FA::Builder nfa;
 		items.clear();
 		items.push_back(first);
 		QVector<lr1item> state2item;
 		QHash<lr1item, FA::State> item2state;
-		item2state[first]=fa.addState();
+		item2state[first]=nfa.addState();
 		state2item.append(first);
 		
 		itemcnt=0;
@@ -408,8 +409,8 @@ PDA CFG::toPDA(bool lr1)const {
 					FA::State dstState;
 					QHash<lr1item, FA::State>::const_iterator it(item2state.find(dstItem));
 					if(it==item2state.end()) {
-						dstState=fa.addState();
-						fa.addMark(dstState, FA::Mark(dstState.id()));
+						dstState=nfa.addState();
+						nfa.addMark(dstState, FA::Mark(dstState.id()));
 						item2state[dstItem]=dstState;
 						Q_ASSERT(dstState.id()==state2item.size());
 						state2item.append(dstItem);
@@ -418,22 +419,22 @@ PDA CFG::toPDA(bool lr1)const {
 					} else {
 						dstState=it.value();
 					}
-					fa.addETransition(curState, dstState);
+					nfa.addETransition(curState, dstState);
 				}
 			}
 			const lr1item dstItem(curItem.next());
 			Q_ASSERT(!item2state.contains(dstItem));
-			const FA::State dstState(item2state[dstItem]=fa.addState());
+			const FA::State dstState(item2state[dstItem]=nfa.addState());
 			//Q_ASSERT(!item2state.contains(lalr1Item.next()));
 			//const FA::State dstState(item2state[lalr1Item.next()]=fa.addState());
 			Q_ASSERT(dstState.id()==state2item.size());
 			state2item.append(dstItem);
-			fa.addMark(dstState, FA::Mark(dstState.id()));
+			nfa.addMark(dstState, FA::Mark(dstState.id()));
 			items.push_back(dstItem);
-			fa.addTransition(curState, FA::Range(FA::Symbol(curSym._id+(curSym.isTerminal()?0:terminals.size()+1))), dstState);
+			nfa.addTransition(curState, FA::Range(FA::Symbol(curSym._id+(curSym.isTerminal()?0:terminals.size()+1))), dstState);
 		}
 		
-		fa=fa.deterministic();
+		const FA fa(nfa.finalize().deterministic());
 		
 		pda=PDA();
 		pda.setFA(fa);
@@ -508,6 +509,443 @@ PDA CFG::toPDA(bool lr1)const {
 	
 }
 
+namespace {
+	//DeRemer and Pennello's digraph: every set is united with the sets of all nodes
+	//reachable from it, the nodes of a cycle end up sharing one set
+	void digraph(const QVector<QList<int> > & edges, QVector<QBitArray> & sets) {
+		const int n(sets.size());
+		const int done(n+1);
+		QVector<int> depth(n, 0);
+		QList<int> stack;
+		QList<QPair<int, int> > path;
+		for(int x(0); x<n; ++x) {
+			if(depth[x])continue;
+			stack.append(x);
+			depth[x]=stack.size();
+			path.append(QPair<int, int>(x, 0));
+			while(path.size()) {
+				const int v(path.last().first);
+				const int e(path.last().second);
+				if(e<edges[v].size()) {
+					path.last().second++;
+					const int w(edges[v][e]);
+					if(!depth[w]) {
+						stack.append(w);
+						depth[w]=stack.size();
+						path.append(QPair<int, int>(w, 0));
+					} else {
+						depth[v]=qMin(depth[v], depth[w]);
+						sets[v]|=sets[w];
+					}
+					continue;
+				}
+				path.removeLast();
+				if(stack[depth[v]-1]==v) {
+					int t;
+					do {
+						t=stack.last();
+						stack.removeLast();
+						depth[t]=done;
+						sets[t]=sets[v];
+					} while(t!=v);
+				}
+				if(path.size()) {
+					const int u(path.last().first);
+					depth[u]=qMin(depth[u], depth[v]);
+					sets[u]|=sets[v];
+				}
+			}
+		}
+	}
+	
+	//items are numbered production by production, the symbols like the transitions of
+	//the automaton: terminals, end of input, nonterminals
+	struct ItemTable {
+		int nt;
+		QVector<int> firstItem;
+		QVector<int> itemProd;
+		QVector<int> itemNext;
+		QVector<QList<int> > alternatives;
+		QVector<bool> nullable;
+		QVector<bool> restNullable;
+		QVector<QBitArray> restFirst;
+	};
+	
+	bool intersects(const QBitArray & a, const QBitArray & b) {
+		const int n(qMin(a.size(), b.size()));
+		for(int i(0); i<n; ++i) {
+			if(a.testBit(i) && b.testBit(i))return true;
+		}
+		return false;
+	}
+	
+	//Pager's weak compatibility of the lookaheads of two kernels with the same items
+	bool weaklyCompatible(const QVector<QBitArray> & a, const QVector<QBitArray> & b) {
+		const int n(a.size());
+		for(int i(0); i<n; ++i) {
+			for(int j(i+1); j<n; ++j) {
+				if(!intersects(a[i], b[j]) && !intersects(a[j], b[i]))continue;
+				if(intersects(a[i], a[j]) || intersects(b[i], b[j]))continue;
+				return false;
+			}
+		}
+		return true;
+	}
+	
+	bool unite(QVector<QBitArray> & to, const QVector<QBitArray> & from) {
+		bool res(false);
+		for(int i(0); i<to.size(); ++i) {
+			const QBitArray before(to[i]);
+			to[i]|=from[i];
+			if(to[i]!=before)res=true;
+		}
+		return res;
+	}
+	
+	//the closure of a kernel of lr(1) items. The items added for a nonterminal share its
+	//lookaheads, slot maps every nonterminal to -1 before and after.
+	void closure(const ItemTable & t, const QList<int> & kernel, const QVector<QBitArray> & kernelLA, QList<int> & items, QVector<QBitArray> & la, QVector<int> & slot) {
+		QList<int> nts;
+		QVector<QBitArray> ntLA;
+		QVector<bool> queued;
+		QList<int> todo;
+		for(int i(0); i<kernel.size(); ++i)todo.append(-i-1);
+		while(todo.size()) {
+			const int x(todo.first());
+			todo.removeFirst();
+			QList<int> sources;
+			QBitArray from;
+			if(x<0) {
+				sources.append(kernel[-x-1]);
+				from=kernelLA[-x-1];
+			} else {
+				queued[x]=false;
+				foreach(int p, t.alternatives[nts[x]])sources.append(t.firstItem[p]);
+				from=ntLA[x];
+			}
+			foreach(int item, sources) {
+				const int sym(t.itemNext[item]);
+				if(sym<=t.nt)continue;
+				QBitArray ahead(t.restFirst[item+1]);
+				if(t.restNullable[item+1])ahead|=from;
+				const int a(sym-t.nt-1);
+				if(slot[a]<0) {
+					slot[a]=nts.size();
+					nts.append(a);
+					ntLA.append(ahead);
+					queued.append(true);
+					todo.append(slot[a]);
+				} else {
+					QBitArray & dst=ntLA[slot[a]];
+					const QBitArray before(dst);
+					dst|=ahead;
+					if(dst!=before && !queued[slot[a]]) {
+						queued[slot[a]]=true;
+						todo.append(slot[a]);
+					}
+				}
+			}
+		}
+		items=kernel;
+		la=kernelLA;
+		for(int i(0); i<nts.size(); ++i) {
+			foreach(int p, t.alternatives[nts[i]]) {
+				items.append(t.firstItem[p]);
+				la.append(ntLA[i]);
+			}
+			slot[nts[i]]=-1;
+		}
+	}
+}
+
+PDA CFG::toLR(bool lr1)const {
+	QSet<Symbol> start_cands(startSymbols());
+	if(start_cands.size()!=1) {
+		return PDA();
+	}
+	const Symbol start_org(*(start_cands.begin()));
+	const QVector<ProductionInfo> prods(QVector<ProductionInfo>(this->prods)<<ProductionInfo(Symbol(nonterminals.size(), false), QList<Shift>()<<Shift(start_org, Action()), Action("*", QList<Arg>())));
+	const int np(prods.size());
+	const int nt(terminals.size());
+	const int nn(nonterminals.size()+1);
+	
+	ItemTable t;
+	t.nt=nt;
+	t.firstItem.resize(np);
+	t.alternatives.resize(nn);
+	for(int p(0); p<np; ++p) {
+		const ProductionInfo & pinfo=prods[p];
+		t.firstItem[p]=t.itemProd.size();
+		for(int m(0); m<=pinfo.size(); ++m) {
+			t.itemProd.append(p);
+			if(m<pinfo.size()) {
+				const Symbol sym(pinfo.shift(m).symbol());
+				t.itemNext.append(sym._id+(sym.isTerminal()?0:nt+1));
+			} else {
+				t.itemNext.append(-1);
+			}
+		}
+		t.alternatives[pinfo.leftSide()].append(p);
+	}
+	const int ni(t.itemProd.size());
+	
+	t.nullable=QVector<bool>(nn, false);
+	QVector<QBitArray> first(nn, QBitArray(nt+1));
+	for(bool changed(true); changed; ) {
+		changed=false;
+		for(int p(0); p<np; ++p) {
+			const int left(prods[p].leftSide());
+			const QBitArray before(first[left]);
+			int item(t.firstItem[p]);
+			for(; t.itemNext[item]>=0; ++item) {
+				const int sym(t.itemNext[item]);
+				if(sym<nt) {
+					first[left].setBit(sym);
+					break;
+				}
+				first[left]|=first[sym-nt-1];
+				if(!t.nullable[sym-nt-1])break;
+			}
+			if(t.itemNext[item]<0 && !t.nullable[left]) {
+				t.nullable[left]=true;
+				changed=true;
+			}
+			if(first[left]!=before)changed=true;
+		}
+	}
+	t.restNullable.resize(ni);
+	t.restFirst.resize(ni);
+	for(int p(0); p<np; ++p) {
+		bool restNullable(true);
+		QBitArray restFirst(nt+1);
+		for(int item(t.firstItem[p]+prods[p].size()); ; --item) {
+			t.restNullable[item]=restNullable;
+			t.restFirst[item]=restFirst;
+			if(item==t.firstItem[p])break;
+			const int sym(t.itemNext[item-1]);
+			if(sym<nt) {
+				restFirst=QBitArray(nt+1);
+				restFirst.setBit(sym);
+				restNullable=false;
+			} else if(t.nullable[sym-nt-1]) {
+				restFirst|=first[sym-nt-1];
+			} else {
+				restFirst=first[sym-nt-1];
+				restNullable=false;
+			}
+		}
+	}
+	
+	//the states with their items, successors and the lookaheads of their reductions,
+	//numbered in the order they are found, successors by ascending symbols
+	QVector<QList<int> > closures;
+	QVector<QMap<int, int> > gotos;
+	QHash<QPair<int, int>, QBitArray> ahead;
+	
+	if(!lr1) {
+		//the lr(0) automaton with lookaheads as described by DeRemer and Pennello
+		QHash<QList<int>, int> kernels;
+		QList<QList<int> > todo;
+		todo.append(QList<int>()<<t.firstItem[np-1]);
+		kernels.insert(todo.first(), 0);
+		QVector<int> stamp(nn, -1);
+		for(int s(0); s<todo.size(); ++s) {
+			QList<int> items(todo[s]);
+			for(int i(0); i<items.size(); ++i) {
+				const int sym(t.itemNext[items[i]]);
+				if(sym<=nt)continue;
+				const int a(sym-nt-1);
+				if(stamp[a]==s)continue;
+				stamp[a]=s;
+				foreach(int p, t.alternatives[a])items.append(t.firstItem[p]);
+			}
+			QMap<int, QList<int> > next;
+			foreach(int item, items) {
+				if(t.itemNext[item]>=0)next[t.itemNext[item]].append(item+1);
+			}
+			QMap<int, int> out;
+			for(QMap<int, QList<int> >::iterator it(next.begin()); it!=next.end(); ++it) {
+				QList<int> & kernel=it.value();
+				qSort(kernel);
+				QHash<QList<int>, int>::const_iterator k(kernels.find(kernel));
+				if(k==kernels.end()) {
+					k=kernels.insert(kernel, todo.size());
+					todo.append(kernel);
+				}
+				out.insert(it.key(), k.value());
+			}
+			closures.append(items);
+			gotos.append(out);
+		}
+		const int ns(closures.size());
+		
+		//the transitions on nonterminals, their follow sets start with the terminals read
+		//directly after them and are completed through the reads and includes relations
+		QVector<int> ntFrom;
+		QVector<int> ntSym;
+		QHash<QPair<int, int>, int> ntIndex;
+		for(int s(0); s<ns; ++s) {
+			const QMap<int, int> & out=gotos[s];
+			for(QMap<int, int>::const_iterator it(out.lowerBound(nt+1)); it!=out.end(); ++it) {
+				ntIndex.insert(QPair<int, int>(s, it.key()), ntFrom.size());
+				ntFrom.append(s);
+				ntSym.append(it.key());
+			}
+		}
+		const int nx(ntFrom.size());
+		QVector<QBitArray> follow(nx, QBitArray(nt+1));
+		QVector<QList<int> > edges(nx);
+		for(int x(0); x<nx; ++x) {
+			const int r(gotos[ntFrom[x]].value(ntSym[x]));
+			const QMap<int, int> & out=gotos[r];
+			for(QMap<int, int>::const_iterator it(out.begin()); it!=out.end(); ++it) {
+				if(it.key()<nt) {
+					follow[x].setBit(it.key());
+				} else if(t.nullable[it.key()-nt-1]) {
+					edges[x].append(ntIndex.value(QPair<int, int>(r, it.key())));
+				}
+			}
+		}
+		follow[ntIndex.value(QPair<int, int>(0, start_org._id+nt+1))].setBit(nt);
+		digraph(edges, follow);
+		
+		QHash<QPair<int, int>, QList<int> > lookback;
+		for(int x(0); x<nx; ++x)edges[x].clear();
+		for(int x(0); x<nx; ++x) {
+			foreach(int p, t.alternatives[ntSym[x]-nt-1]) {
+				int q(ntFrom[x]);
+				for(int item(t.firstItem[p]); t.itemNext[item]>=0; ++item) {
+					const int sym(t.itemNext[item]);
+					if(sym>nt && t.restNullable[item+1])edges[ntIndex.value(QPair<int, int>(q, sym))].append(x);
+					q=gotos[q].value(sym);
+				}
+				lookback[QPair<int, int>(q, p)].append(x);
+			}
+		}
+		digraph(edges, follow);
+		
+		for(QHash<QPair<int, int>, QList<int> >::const_iterator it(lookback.begin()); it!=lookback.end(); ++it) {
+			QBitArray & la=ahead[it.key()];
+			la=QBitArray(nt+1);
+			foreach(int x, it.value())la|=follow[x];
+		}
+	} else {
+		//Pager's minimal lr(1) automaton: a successor is merged into the first weakly
+		//compatible state with the same core, whose own successors then receive the
+		//added lookaheads along the existing transitions
+		QVector<QList<int> > cores;
+		QVector<QVector<QBitArray> > kernelLA;
+		QHash<QList<int>, QList<int> > byCore;
+		QVector<bool> expanded;
+		QVector<bool> queued;
+		QList<int> todo;
+		QVector<int> slot(nn, -1);
+		cores.append(QList<int>()<<t.firstItem[np-1]);
+		kernelLA.append(QVector<QBitArray>()<<QBitArray(nt+1));
+		kernelLA[0][0].setBit(nt);
+		byCore[cores[0]].append(0);
+		gotos.append(QMap<int, int>());
+		expanded.append(false);
+		queued.append(true);
+		todo.append(0);
+		while(todo.size()) {
+			const int s(todo.first());
+			todo.removeFirst();
+			queued[s]=false;
+			QList<int> items;
+			QVector<QBitArray> la;
+			closure(t, cores[s], kernelLA[s], items, la, slot);
+			QMap<int, QMap<int, QBitArray> > next;
+			for(int i(0); i<items.size(); ++i) {
+				if(t.itemNext[items[i]]>=0)next[t.itemNext[items[i]]].insert(items[i]+1, la[i]);
+			}
+			for(QMap<int, QMap<int, QBitArray> >::const_iterator it(next.begin()); it!=next.end(); ++it) {
+				const QList<int> core(it.value().keys());
+				const QVector<QBitArray> kernel(it.value().values().toVector());
+				int dst(-1);
+				if(expanded[s]) {
+					dst=gotos[s].value(it.key());
+				} else {
+					foreach(int c, byCore.value(core)) {
+						if(weaklyCompatible(kernelLA[c], kernel)) {
+							dst=c;
+							break;
+						}
+					}
+					if(dst<0) {
+						dst=cores.size();
+						cores.append(core);
+						kernelLA.append(kernel);
+						byCore[core].append(dst);
+						gotos.append(QMap<int, int>());
+						expanded.append(false);
+						queued.append(true);
+						todo.append(dst);
+					}
+					gotos[s].insert(it.key(), dst);
+				}
+				if(unite(kernelLA[dst], kernel) && !queued[dst]) {
+					queued[dst]=true;
+					todo.append(dst);
+				}
+			}
+			expanded[s]=true;
+		}
+		
+		const int ns(cores.size());
+		for(int s(0); s<ns; ++s) {
+			QList<int> items;
+			QVector<QBitArray> la;
+			closure(t, cores[s], kernelLA[s], items, la, slot);
+			for(int i(0); i<items.size(); ++i) {
+				if(t.itemNext[items[i]]<0)ahead.insert(QPair<int, int>(s, t.itemProd[items[i]]), la[i]);
+			}
+			closures.append(items);
+		}
+	}
+	const int ns(closures.size());
+	
+	FA::Builder builder;
+	for(int s(0); s<ns; ++s)builder.addState();
+	for(int s(0); s<ns; ++s) {
+		const QMap<int, int> & out=gotos[s];
+		for(QMap<int, int>::const_iterator it(out.begin()); it!=out.end(); ++it) {
+			builder.addTransition(FA::State(s), FA::Range(FA::Symbol(it.key())), FA::State(it.value()));
+		}
+	}
+	FA fa(builder.finalize());
+	fa.makeDense();
+	
+	PDA pda;
+	pda.setFA(fa);
+	
+	for(int s(0); s<ns; ++s) {
+		const FA::State state(s);
+		foreach(int item, closures[s]) {
+			const int p(t.itemProd[item]);
+			const int mark(item-t.firstItem[p]);
+			const ProductionInfo & pinfo=prods[p];
+			if(mark==pinfo.size()) {
+				QBitArray la(ahead.value(QPair<int, int>(s, p), QBitArray(nt+1)));
+				if(p==np-1)la.setBit(nt);
+				for(int i(0); i<=nt; ++i) {
+					if(la.testBit(i))pda.addLookAheadAction(state, i, pda.reduceAction(Production(p)));
+				}
+			} else {
+				const int sym(t.itemNext[item]);
+				PDA::Action act;
+				if(pinfo.shift(mark).action().isValid()) {
+					act=pda.shiftAction(Production(p), mark);
+				} else {
+					pda.addNonAction(state, sym, pda.shift(Production(p), mark));
+				}
+				pda.addLookAheadAction(state, sym, act);
+			}
+		}
+	}
+	return pda;
+}
+
 qint32 qHash(const CFG::Symbol & s) {
 	return s.hash();
 }
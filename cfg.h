@@ -160,6 +160,7 @@ class CFG {
 		QSet<Symbol> startSymbols()const;
 		
 		PDA toPDA(bool lr1)const;
+		PDA toLR(bool lr1)const;
 };
 
 qint32 qHash(const CFG::Symbol & s);
@@ -22,16 +22,17 @@
 
 #include <QVector>
 #include <QMap>
-#include <QLinkedList>
+#include <QtAlgorithms>
 
 #include <QBuffer>
 #include <QTextStream>
 
-FA::FA() {}
+FA::FA():dense(false) {}
 
 FA::State FA::addState() {
 	State res(states.size());
 	states.append(QSet<Mark>());
+	if(dense)dtable.insert(dtable.size(), dranges.size(), -1);
 	if(!startState.isValid())startState=res;
 	return res;
 }
@@ -40,6 +41,204 @@ int FA::count()const {
 	return states.size();
 }
 
+bool FA::isDense()const {
+	return dense;
+}
+
+void FA::makeDense() {
+	if(dense)return;
+	const int nr(trans.size());
+	dranges=QVector<Range>(nr);
+	dtable=QVector<int>(states.size()*nr, -1);
+	for(int r=0; r<nr; r++) {
+		dranges[r]=trans[r].first;
+		const QHash<State, State> & h=trans[r].second;
+		for(QHash<State, State>::const_iterator it(h.begin()); it!=h.end(); ++it) {
+			dtable[it.key().id()*nr+r]=it.value().id();
+		}
+	}
+	trans.clear();
+	dense=true;
+}
+
+//splits the dense ranges at the bounds of the given sorted ranges and adds columns where
+//they cover no range yet; returns for every column the given range it lies in or -1
+QVector<int> FA::splitDense(const QVector<Range> & ranges) {
+	Q_ASSERT(dense);
+	const int nr(dranges.size());
+	const int ng(ranges.size());
+	QVector<int> bounds;
+	for(int r=0; r<nr; r++) {
+		bounds.append(dranges[r].from.id());
+		bounds.append(dranges[r].to.id());
+	}
+	for(int g=0; g<ng; g++) {
+		bounds.append(ranges[g].from.id());
+		bounds.append(ranges[g].to.id());
+	}
+	qSort(bounds);
+	QVector<int> points;
+	foreach(int b, bounds) {
+		if(!points.size() || points.last()!=b)points.append(b);
+	}
+	QVector<Range> nranges;
+	QVector<int> column;
+	QVector<int> owner;
+	int r(0);
+	int g(0);
+	for(int k=0; k+1<points.size(); k++) {
+		const Symbol from(points[k]);
+		while(r<nr && dranges[r].to<=from)r++;
+		while(g<ng && ranges[g].to<=from)g++;
+		const int c(r<nr && dranges[r].from<=from?r:-1);
+		const int o(g<ng && ranges[g].from<=from?g:-1);
+		if(c<0 && o<0)continue;
+		nranges.append(Range(from, Symbol(points[k+1])));
+		column.append(c);
+		owner.append(o);
+	}
+	const int n(states.size());
+	const int nn(nranges.size());
+	QVector<int> table(n*nn, -1);
+	for(int s=0; s<n; s++) {
+		for(int k=0; k<nn; k++) {
+			if(column[k]>=0)table[s*nn+k]=dtable[s*nr+column[k]];
+		}
+	}
+	dranges=nranges;
+	dtable=table;
+	return owner;
+}
+
+void FA::adjacency(QVector<int> & rowStart, QVector<int> & edgeRange, QVector<int> & edgeTarget)const {
+	const int n(states.size());
+	const int nr(rangeCount());
+	rowStart=QVector<int>(n+1, 0);
+	if(dense) {
+		for(int i=0; i<n*nr; i++) {
+			if(dtable[i]>=0)rowStart[i/nr+1]++;
+		}
+	} else {
+		for(int r=0; r<nr; r++) {
+			const QHash<State, State> & h=trans[r].second;
+			for(QHash<State, State>::const_iterator it(h.begin()); it!=h.end(); ++it) {
+				rowStart[it.key().id()+1]++;
+			}
+		}
+	}
+	for(int s=0; s<n; s++)rowStart[s+1]+=rowStart[s];
+	edgeRange=QVector<int>(rowStart[n]);
+	edgeTarget=QVector<int>(rowStart[n]);
+	QVector<int> cursor(rowStart);
+	//ranges are visited in ascending order, so every row ends up sorted by range
+	for(int r=0; r<nr; r++) {
+		if(dense) {
+			for(int s=0; s<n; s++) {
+				const int to(dtable[s*nr+r]);
+				if(to<0)continue;
+				const int e(cursor[s]++);
+				edgeRange[e]=r;
+				edgeTarget[e]=to;
+			}
+		} else {
+			const QHash<State, State> & h=trans[r].second;
+			for(QHash<State, State>::const_iterator it(h.begin()); it!=h.end(); ++it) {
+				const int e(cursor[it.key().id()]++);
+				edgeRange[e]=r;
+				edgeTarget[e]=it.value().id();
+			}
+		}
+	}
+}
+
+void FA::epsilonClosures(QVector<int> & comp, QVector<int> & closureStart, QVector<int> & closurePool)const {
+	const int n(states.size());
+	QVector<int> eStart(n+1, 0);
+	foreach(const StatePair & p, etrans) {
+		Q_ASSERT(p.first.isValid() && p.first.id()<n);
+		eStart[p.first.id()+1]++;
+	}
+	for(int s=0; s<n; s++)eStart[s+1]+=eStart[s];
+	QVector<int> eTarget(eStart[n]);
+	{
+		QVector<int> cursor(eStart);
+		foreach(const StatePair & p, etrans) {
+			eTarget[cursor[p.first.id()]++]=p.second.id();
+		}
+	}
+	
+	//Tarjan's algorithm without recursion; components are completed in reverse topological
+	//order, so the closures of all successor components are known when a component is closed
+	comp=QVector<int>(n, -1);
+	closureStart=QVector<int>(1, 0);
+	closurePool.clear();
+	QVector<int> index(n, -1);
+	QVector<int> low(n);
+	QVector<int> next(n);
+	QVector<int> stack;
+	QVector<int> call;
+	QVector<int> stamp(n, -1);
+	QVector<int> compStamp(n, -1);
+	QVector<int> closure;
+	int counter(0);
+	for(int root=0; root<n; root++) {
+		if(index[root]>=0)continue;
+		index[root]=low[root]=counter++;
+		next[root]=eStart[root];
+		stack.append(root);
+		call.append(root);
+		while(call.size()) {
+			const int v(call.last());
+			if(next[v]<eStart[v+1]) {
+				const int w(eTarget[next[v]++]);
+				if(index[w]<0) {
+					index[w]=low[w]=counter++;
+					next[w]=eStart[w];
+					stack.append(w);
+					call.append(w);
+				} else if(comp[w]<0) {
+					low[v]=qMin(low[v], index[w]);
+				}
+				continue;
+			}
+			call.remove(call.size()-1);
+			if(call.size())low[call.last()]=qMin(low[call.last()], low[v]);
+			if(low[v]!=index[v])continue;
+			
+			const int c(closureStart.size()-1);
+			int top(stack.size());
+			do {
+				top--;
+				comp[stack[top]]=c;
+			} while(stack[top]!=v);
+			closure.clear();
+			for(int i=top; i<stack.size(); i++) {
+				const int m(stack[i]);
+				stamp[m]=c;
+				closure.append(m);
+			}
+			for(int i=top; i<stack.size(); i++) {
+				const int m(stack[i]);
+				for(int e(eStart[m]); e<eStart[m+1]; e++) {
+					const int d(comp[eTarget[e]]);
+					if(d==c || compStamp[d]==c)continue;
+					compStamp[d]=c;
+					for(int k(closureStart[d]); k<closureStart[d+1]; k++) {
+						const int x(closurePool[k]);
+						if(stamp[x]==c)continue;
+						stamp[x]=c;
+						closure.append(x);
+					}
+				}
+			}
+			stack.resize(top);
+			qSort(closure);
+			closurePool+=closure;
+			closureStart.append(closurePool.size());
+		}
+	}
+}
+
 void FA::addMark(State s, Mark m) {
 	Q_ASSERT(s.isValid());
 	Q_ASSERT(s.id()<states.size());
@@ -73,17 +272,17 @@ bool FA::isDeterministic()const {
 }
 
 int FA::search(Symbol s)const {
-	const int n(trans.size());
-	if(!trans.size())return -1;
-	if(s<trans[0].first.from)return -1;
-	if(trans[n-1].first.to<=s)return 2*n-1;
+	const int n(rangeCount());
+	if(!n)return -1;
+	if(s<range(0).from)return -1;
+	if(range(n-1).to<=s)return 2*n-1;
 	int left(0);
 	int right((n-1)*2);
 	while(left<right) {
 		const int mid((left+right)/2);
-		Q_ASSERT(mid>=0 && ((mid+1)/2<trans.size()));
-		const Range r1(trans[mid/2].first);
-		const Range r2(trans[(mid+1)/2].first);
+		Q_ASSERT(mid>=0 && ((mid+1)/2<n));
+		const Range r1(range(mid/2));
+		const Range r2(range((mid+1)/2));
 		const Symbol s1(mid%2?r1.to:r1.from);
 		const Symbol s2(mid%2?r2.from:r2.to);
 		if(s<s1) {
@@ -102,12 +301,25 @@ int FA::search(Symbol s)const {
 
 bool FA::addTransition(State from, const Range & on, State to) {
 // 	qDebug("bool FA::addTransition(State from:%d, const Range & on:%d-%d, State to:%d)", from.id(), on.from.id(), on.to.id(), to.id());
-	print();
 	Q_ASSERT(from.isValid());
 	Q_ASSERT(from.id()<states.size());
 	Q_ASSERT(to.isValid());
 	Q_ASSERT(to.id()<states.size());
 	Q_ASSERT(on.isValid());
+	if(dense) {
+		const QVector<int> owner(splitDense(QVector<Range>()<<on));
+		const int nr(dranges.size());
+		int *row(dtable.data()+from.id()*nr);
+		bool free(true);
+		for(int r=0; r<nr; r++) {
+			if(owner[r]>=0 && row[r]>=0)free=false;
+		}
+		for(int r=0; free && r<nr; r++) {
+			if(owner[r]>=0)row[r]=to.id();
+		}
+		compress();
+		return free;
+	}
 	Range range(on);
 	while(range.isValid()) {
 		const Symbol left(range.from);
@@ -181,13 +393,24 @@ FA::State FA::transition(State from, Symbol on)const {
 	int p(search(on));
 	if(p%2)return State();
 	p/=2;
-	Q_ASSERT(p>=0&&p<trans.size());
+	Q_ASSERT(p>=0&&p<rangeCount());
+	if(dense) {
+		const int to(dtable[from.id()*dranges.size()+p]);
+		return to<0?State():State(to);
+	}
 	return trans[p].second.value(from);
 }
 
 QVector<FA::State> FA::transitions(State from)const {
-	const int n(trans.size());
+	const int n(rangeCount());
 	QVector<State> res(n);
+	if(dense) {
+		const int *row(dtable.constData()+from.id()*n);
+		for(int i=0; i<n; i++) {
+			if(row[i]>=0)res[i]=State(row[i]);
+		}
+		return res;
+	}
 	for(int i=0; i<n; i++) {
 		res[i]=trans[i].second.value(from);
 	}
@@ -220,9 +443,33 @@ FA::StatePair FA::insert(const FA & src, bool keepMarks) {
 			if(keepMarks)states[end.id()].unite(src.marks(State(i)));
 		}
 	}
+	if(dense) {
+		//the alphabet is split once for all transitions of src
+		QVector<Range> ranges(nr);
+		for(int r=0; r<nr; r++)ranges[r]=src.range(r);
+		const QVector<int> owner(splitDense(ranges));
+		const int nn(dranges.size());
+		for(int i=0; i<n; i++) {
+			const QVector<State> row(src.transitions(State(i)));
+			int *dst(dtable.data()+(i+offset)*nn);
+			for(int k=0; k<nn; k++) {
+				if(owner[k]>=0 && row[owner[k]].isValid())dst[k]=row[owner[k]].id()+offset;
+			}
+		}
+		compress();
+		return StatePair(start, end);
+	}
 	for(int i=0; i<n; i++) {
 		const State st_src(i);
 		const State st_fa(i+offset);
+		if(src.dense) {
+			const int *row(src.dtable.constData()+i*nr);
+			for(int r=0; r<nr; r++) {
+				if(row[r]<0)continue;
+				addTransition(st_fa, src.dranges[r], FA::State(row[r]+offset));
+			}
+			continue;
+		}
 		for(int r=0; r<nr; r++) {
 			Range range(src.range(r));
 			const State dst(src.transition(st_src, range.from));
@@ -234,57 +481,248 @@ FA::StatePair FA::insert(const FA & src, bool keepMarks) {
 }
 
 int FA::rangeCount()const {
-	return trans.size();
+	return dense?dranges.size():trans.size();
 }
 
 FA::Range FA::range(int r)const {
-	return trans[r].first;
+	return dense?dranges[r]:trans[r].first;
+}
+
+FA::State FA::Builder::addState() {
+	State res(states.size());
+	states.append(QSet<Mark>());
+	head.append(-1);
+	eouts.append(QList<State>());
+	if(!startState.isValid())startState=res;
+	return res;
+}
+
+int FA::Builder::count()const {
+	return states.size();
+}
+
+void FA::Builder::addMark(State s, Mark m) {
+	Q_ASSERT(s.isValid());
+	Q_ASSERT(s.id()<states.size());
+	states[s.id()].insert(m);
+}
+
+void FA::Builder::setStart(State s) {
+	Q_ASSERT(s.isValid());
+	Q_ASSERT(s.id()<states.size());
+	startState=s;
+}
+
+FA::State FA::Builder::start()const {
+	return startState;
+}
+
+void FA::Builder::addTransition(State from, const Range & on, State to) {
+	Q_ASSERT(from.isValid());
+	Q_ASSERT(from.id()<states.size());
+	Q_ASSERT(to.isValid());
+	Q_ASSERT(to.id()<states.size());
+	Q_ASSERT(on.isValid());
+	edges.append(Edge(from, on, to, head[from.id()]));
+	head[from.id()]=edges.size()-1;
+}
+
+bool FA::Builder::addETransition(State from, State to) {
+	Q_ASSERT(from.isValid() && from.id()<states.size());
+	Q_ASSERT(to.isValid() && to.id()<states.size());
+	StatePair p(from, to);
+	if(etrans.contains(p))return false;
+	etrans.insert(p);
+	eouts[from.id()].append(to);
+	return true;
+}
+
+FA::StatePair FA::Builder::insert(const FA & src, bool keepMarks) {
+	State start(addState());
+	State end(addState());
+	const int offset(end.id()+1);
+	Q_ASSERT(src.isDeterministic());
+	const int n(src.count());
+	const int nr(src.rangeCount());
+	for(int i=0; i<n; i++) {
+		State s(addState());
+		if(src.start()==State(i)) {
+			addETransition(start, s);
+		}
+		if(src.marks(State(i)).size()) {
+			addETransition(s, end);
+			if(keepMarks)states[end.id()].unite(src.marks(State(i)));
+		}
+	}
+	for(int i=0; i<n; i++) {
+		const QVector<State> row(src.transitions(State(i)));
+		for(int r=0; r<nr; r++) {
+			if(!row[r].isValid())continue;
+			addTransition(State(i+offset), src.range(r), State(row[r].id()+offset));
+		}
+	}
+	return StatePair(start, end);
+}
+
+FA FA::Builder::finalize()const {
+	FA res;
+	res.states=states;
+	res.etrans=etrans;
+	res.startState=startState;
+	const int ne(edges.size());
+	QVector<int> bounds;
+	for(int e=0; e<ne; e++) {
+		bounds.append(edges[e].on.from.id());
+		bounds.append(edges[e].on.to.id());
+	}
+	qSort(bounds);
+	QVector<int> points;
+	foreach(int b, bounds) {
+		if(!points.size() || points.last()!=b)points.append(b);
+	}
+	//every edge covers a run of elementary intervals between consecutive endpoints
+	const int nint(qMax(points.size()-1, 0));
+	QVector<QHash<State, State> > cells(nint);
+	for(int e=0; e<ne; e++) {
+		const Edge & edge=edges[e];
+		const int first(qLowerBound(points.constBegin(), points.constEnd(), edge.on.from.id())-points.constBegin());
+		const int last(qLowerBound(points.constBegin(), points.constEnd(), edge.on.to.id())-points.constBegin());
+		for(int k=first; k<last; k++) {
+			QHash<State, State> & h=cells[k];
+			if(!h.contains(edge.from))h.insert(edge.from, edge.to);
+		}
+	}
+	for(int k=0; k<nint; k++) {
+		if(!cells[k].size())continue;
+		res.trans.append(QPair<Range, QHash<State, State> >(Range(Symbol(points[k]), Symbol(points[k+1])), cells[k]));
+	}
+	res.compress();
+	return res;
+}
+
+//copies the part reachable from p.first, p.second becomes the only marked state
+FA FA::Builder::extract(const StatePair & p)const {
+	Q_ASSERT(p.first.isValid() && p.first.id()<states.size());
+	Q_ASSERT(p.second.isValid() && p.second.id()<states.size());
+	Builder res;
+	QHash<int, int> map;
+	QVector<int> todo;
+	map.insert(p.first.id(), res.addState().id());
+	todo.append(p.first.id());
+	for(int i=0; i<todo.size(); i++) {
+		const int s(todo[i]);
+		for(int e(head[s]); e>=0; e=edges[e].next) {
+			const int t(edges[e].to.id());
+			if(map.contains(t))continue;
+			map.insert(t, res.addState().id());
+			todo.append(t);
+		}
+		foreach(State t, eouts[s]) {
+			if(map.contains(t.id()))continue;
+			map.insert(t.id(), res.addState().id());
+			todo.append(t.id());
+		}
+	}
+	//edges are replayed oldest first, so finalize() resolves conflicts the same way
+	for(int i=0; i<todo.size(); i++) {
+		const int s(todo[i]);
+		QVector<int> out;
+		for(int e(head[s]); e>=0; e=edges[e].next)out.append(e);
+		for(int k=out.size()-1; k>=0; k--) {
+			const Edge & edge=edges[out[k]];
+			res.addTransition(State(map.value(s)), edge.on, State(map.value(edge.to.id())));
+		}
+		foreach(State t, eouts[s]) {
+			res.addETransition(State(map.value(s)), State(map.value(t.id())));
+		}
+	}
+	if(map.contains(p.second.id()))res.addMark(State(map.value(p.second.id())), Mark(0));
+	return res.finalize();
 }
 
 namespace {
-	typedef QSet<FA::State> Closure;
-	
-/*	class Closure : public QSet<FA::State> {
+	//interns sorted state sets; every distinct set is stored once in a flat arena and found
+	//again through an open addressing table keyed by a 64 bit fingerprint
+	class SubsetTable {
+		private:
+			QVector<int> arena;
+			QVector<int> starts;
+			QVector<quint64> prints;
+			QVector<int> slots;
+			int mask;
+			static quint64 fingerprint(const int *v, int n);
+			bool equals(int id, const int *v, int n)const;
+			void rehash();
 		public:
-			Closure() {}
-			bool operator < (const Closure & o)const;
+			SubsetTable();
+			int insert(const QVector<int> & set, bool & added);
+			int count()const {return prints.size();}
+			const int * members(int id)const {return arena.constData()+starts[id];}
+			int size(int id)const {return starts[id+1]-starts[id];}
 	};
-
-	bool Closure::operator < (const Closure & o)const {
-		const int n(size());
-		const int no(o.size());
-		if(n<no)return true;
-		if(no<n)return false;
-		QSet<FA::State>::const_iterator it1(begin());
-		QSet<FA::State>::const_iterator it2(o.begin());
-		while(it1!=end()) {
-			const int id1(it1->id());
-			const int id2(it2->id());
-			if(id1<id2)return true;
-			if(id2<id1)return false;
-			++it1;
-			++it2;
+	
+	SubsetTable::SubsetTable():starts(1, 0), slots(64, -1), mask(63) {}
+	
+	quint64 SubsetTable::fingerprint(const int *v, int n) {
+		quint64 h(Q_UINT64_C(0xcbf29ce484222325)^(quint64)n);
+		for(int i=0; i<n; i++) {
+			h^=(quint64)(quint32)v[i];
+			h*=Q_UINT64_C(0x100000001b3);
 		}
-		return false;
-	}*/
+		return h^(h>>29);
+	}
 	
-	template<typename T>
-	bool operator < (const QSet<T> & s1, const QSet<T> & s2) {
-		const int n1(s1.size());
-		const int n2(s2.size());
-		if(n1<n2)return true;
-		if(n2<n1)return false;
-		typename QSet<T>::const_iterator it1(s1.begin());
-		typename QSet<T>::const_iterator it2(s2.begin());
-		while(it1!=s1.end()) {
-			if((*it1)<(*it2))return true;
-			if((*it2)<(*it1))return false;
-			++it1;
-			++it2;
+	bool SubsetTable::equals(int id, const int *v, int n)const {
+		if(size(id)!=n)return false;
+		const int *m(members(id));
+		for(int i=0; i<n; i++) {
+			if(m[i]!=v[i])return false;
 		}
-		return false;
+		return true;
 	}
 	
+	void SubsetTable::rehash() {
+		slots=QVector<int>(slots.size()*2, -1);
+		mask=slots.size()-1;
+		for(int id=0; id<prints.size(); id++) {
+			int slot(prints[id]&mask);
+			while(slots[slot]>=0)slot=(slot+1)&mask;
+			slots[slot]=id;
+		}
+	}
+	
+	int SubsetTable::insert(const QVector<int> & set, bool & added) {
+		const int n(set.size());
+		const int *v(set.constData());
+		const quint64 h(fingerprint(v, n));
+		int slot(h&mask);
+		while(slots[slot]>=0) {
+			const int id(slots[slot]);
+			if(prints[id]==h && equals(id, v, n)) {
+				added=false;
+				return id;
+			}
+			slot=(slot+1)&mask;
+		}
+		const int id(prints.size());
+		slots[slot]=id;
+		prints.append(h);
+		arena+=set;
+		starts.append(arena.size());
+		if(2*prints.size()>slots.size())rehash();
+		added=true;
+		return id;
+	}
+	
+	QVector<int> sortedIds(const QSet<FA::Mark> & marks) {
+		QVector<int> res;
+		foreach(FA::Mark m, marks)res.append(m.id());
+		qSort(res);
+		return res;
+	}
+	
+	FA::Minimization defaultMinimization(FA::Hopcroft);
+	
 	bool operator < (const QVector<int> & v1, const QVector<int> & v2) {
 		const int n1(v1.size());
 		const int n2(v2.size());
@@ -298,262 +736,476 @@ namespace {
 		}
 		return false;
 	}
-}
-
-
-FA FA::deterministic()const {
-	const int nstates(states.size());
-	QVector<Closure> closures(nstates);
-// 	typedef QPair<State, State> StatePair;
-	foreach(const StatePair & p, etrans) {
-		const State & from=p.first;
-		const State & to=p.second;
-		Q_ASSERT(from.isValid() && from.id()<closures.size());
-		closures[from.id()].insert(to);
-	}
-	for(int i=0; i<nstates; i++) {
-		closures[i].insert(State(i));
-	}
-	bool done(false);
-	while(!done) {
-		done=true;
-		for(int i(0); i<nstates; i++) {
-			Closure & closure=closures[i];
-			foreach(State st, closure) {
-				if(st.id()==i)continue;
-				Q_ASSERT(st.id()>=0&&st.id()<closures.size());
-				const int n(closure.size());
-				closure.unite(closures[st.id()]);
-				if(closure.size()>n)done=false;
+	
+	//the original Moore style refinement, kept to cross-check refineHopcroft()
+	void refineMoore(const int *table, int nranges, QVector<int> & state2class, int nclasses) {
+		const int nstates(state2class.size());
+		QList<QList<int> > classes;
+		for(int c=0; c<nclasses; c++)classes.append(QList<int>());
+		for(int s=0; s<nstates; s++) {
+			if(state2class[s]>=0)classes[state2class[s]].append(s);
+		}
+		bool done(false);
+		while(!done) {
+			QList<QList<int> > refined;
+			foreach(const QList<int> & cls, classes) {
+				QMap<QVector<int>, QList<int> > m;
+				foreach(int s, cls) {
+					QVector<int> v(nranges);
+					const int *row(table+s*nranges);
+					for(int r=0; r<nranges; r++) {
+						v[r]=row[r];
+						if(v[r]>=0)v[r]=state2class[v[r]];
+					}
+					m[v].append(s);
+				}
+				for(QMap<QVector<int>, QList<int> >::const_iterator mit(m.begin()); mit!=m.end(); ++mit) {
+					refined.append(mit.value());
+				}
+			}
+			done=(classes.size()==refined.size());
+			classes=refined;
+			for(int i=0; i<classes.size(); i++) {
+				foreach(int s, classes[i])state2class[s]=i;
 			}
 		}
 	}
 	
-	//QBuffer buf;
-	//buf.open(QBuffer::WriteOnly);
-	//QTextStream out(&buf);
-	for(int i=0; i<nstates; i++) {
-		//out<<i<<":\t";
-		const Closure & closure=closures[i];
-		foreach(State s, closure) {
-// 			out<<s.id()<<" ";
+	//Hopcroft's partition refinement over inverse transitions. Missing transitions and
+	//transitions into dropped states lead to an extra sink, which keeps a block of its own.
+	void refineHopcroft(const int *table, int nranges, QVector<int> & state2class, int nclasses) {
+		const int nstates(state2class.size());
+		QVector<int> id(nstates, -1);
+		QVector<int> org;
+		for(int s=0; s<nstates; s++) {
+			if(state2class[s]<0)continue;
+			id[s]=org.size();
+			org.append(s);
+		}
+		const int sink(org.size());
+		const int m(sink+1);
+		
+		QVector<int> invStart(nranges*m+1, 0);
+		QVector<int> delta(m*nranges, sink);
+		for(int q=0; q<sink; q++) {
+			const int *row(table+org[q]*nranges);
+			for(int r=0; r<nranges; r++) {
+				if(row[r]>=0 && id[row[r]]>=0)delta[q*nranges+r]=id[row[r]];
+			}
+		}
+		for(int q=0; q<m; q++) {
+			for(int r=0; r<nranges; r++)invStart[r*m+delta[q*nranges+r]+1]++;
+		}
+		for(int i=0; i<nranges*m; i++)invStart[i+1]+=invStart[i];
+		QVector<int> invSource(invStart[nranges*m]);
+		{
+			QVector<int> cursor(invStart);
+			for(int q=0; q<m; q++) {
+				for(int r=0; r<nranges; r++)invSource[cursor[r*m+delta[q*nranges+r]]++]=q;
+			}
+		}
+		
+		//blocks are contiguous slices [first, end) of elems, marked states are moved to the front
+		QVector<int> block(m);
+		for(int q=0; q<sink; q++)block[q]=state2class[org[q]];
+		block[sink]=nclasses;
+		QVector<int> first(nclasses+1, 0);
+		QVector<int> end(nclasses+1, 0);
+		QVector<int> marked(nclasses+1, 0);
+		for(int q=0; q<m; q++)end[block[q]]++;
+		for(int b=1; b<=nclasses; b++)end[b]+=end[b-1];
+		for(int b=1; b<=nclasses; b++)first[b]=end[b-1];
+		QVector<int> elems(m);
+		QVector<int> loc(m);
+		{
+			QVector<int> cursor(first);
+			for(int q=0; q<m; q++) {
+				loc[q]=cursor[block[q]]++;
+				elems[loc[q]]=q;
+			}
+		}
+		
+		QVector<bool> inWork(m*nranges);
+		QVector<int> work;
+		int largest(0);
+		for(int b=1; b<=nclasses; b++) {
+			if(end[b]-first[b]>end[largest]-first[largest])largest=b;
+		}
+		for(int b=0; b<=nclasses; b++) {
+			if(b==largest)continue;
+			for(int r=0; r<nranges; r++) {
+				inWork[b*nranges+r]=true;
+				work.append(b*nranges+r);
+			}
+		}
+		
+		QVector<int> splitter;
+		QVector<int> touched;
+		while(work.size()) {
+			const int w(work.last());
+			work.remove(work.size()-1);
+			inWork[w]=false;
+			const int b(w/nranges);
+			const int r(w%nranges);
+			splitter.clear();
+			for(int i=first[b]; i<end[b]; i++)splitter.append(elems[i]);
+			touched.clear();
+			foreach(int t, splitter) {
+				for(int e(invStart[r*m+t]); e<invStart[r*m+t+1]; e++) {
+					const int q(invSource[e]);
+					const int c(block[q]);
+					const int mpos(first[c]+marked[c]);
+					if(loc[q]<mpos)continue;
+					const int other(elems[mpos]);
+					elems[loc[q]]=other;
+					loc[other]=loc[q];
+					elems[mpos]=q;
+					loc[q]=mpos;
+					if(!marked[c])touched.append(c);
+					marked[c]++;
+				}
+			}
+			foreach(int c, touched) {
+				const int nmarked(marked[c]);
+				marked[c]=0;
+				if(nmarked==end[c]-first[c])continue;
+				const int nb(first.size());
+				first.append(first[c]);
+				end.append(first[c]+nmarked);
+				marked.append(0);
+				first[c]+=nmarked;
+				for(int i=first[nb]; i<end[nb]; i++)block[elems[i]]=nb;
+				const bool smaller(end[nb]-first[nb]<=end[c]-first[c]);
+				for(int x=0; x<nranges; x++) {
+					const int add(inWork[c*nranges+x] || smaller?nb:c);
+					if(inWork[add*nranges+x])continue;
+					inWork[add*nranges+x]=true;
+					work.append(add*nranges+x);
+				}
+			}
+		}
+		
+		QVector<int> compact(first.size(), -1);
+		int next(0);
+		for(int q=0; q<sink; q++) {
+			if(compact[block[q]]<0)compact[block[q]]=next++;
+			state2class[org[q]]=compact[block[q]];
 		}
-		//out<<"\n";
 	}
+}
+
+
+FA FA::deterministic()const {
+	const int nstates(states.size());
+	QVector<int> comp, closureStart, closurePool;
+	epsilonClosures(comp, closureStart, closurePool);
+	
+	QVector<int> rowStart, edgeRange, edgeTarget;
+	adjacency(rowStart, edgeRange, edgeTarget);
 	
-	QMap<Closure, State> newStates;
+	//dfa states are numbered in the order their subsets are interned, which is also the
+	//order they are processed in
+	SubsetTable subsets;
 	QList<QSet<Mark> > dMarks;
+	bool added;
+	Q_ASSERT(startState.id()>=0&&startState.id()<nstates);
+	QVector<int> dest;
+	const int sc(comp[startState.id()]);
+	for(int k(closureStart[sc]); k<closureStart[sc+1]; k++) {
+		dest.append(closurePool[k]);
+	}
+	subsets.insert(dest, added);
 	dMarks<<QSet<Mark>();
-	Q_ASSERT(startState.id()>=0&&startState.id()<closures.size());
-	newStates[closures[startState.id()]]=State(0);
-	QLinkedList<Closure> todo;
-	todo<<closures[startState.id()];
 	
-	const int nranges(trans.size());
-	QVector<QPair<Range, QHash<State, State> > > dtrans(trans.size());
+	const int nranges(rangeCount());
+	QVector<Range> dranges(nranges);
 	for(int r(0); r<nranges; r++) {
-		dtrans[r].first=trans[r].first;
+		dranges[r]=range(r);
 	}
+	QVector<int> dtable(nranges, -1);
+	QVector<QPair<int, int> > hits;
+	QVector<int> stamp(nstates, -1);
+	int generation(0);
 	
-	while(todo.size()) {
-		Closure closure(todo.front());
-		//out<<"SRC:\t";
-/*		foreach(State s, closure) {
-			out<<s.id()<<" ";
-		}*/
-		//out<<"\n";
-		todo.pop_front();
-		Q_ASSERT(newStates.contains(closure));
-		const State sourceState(newStates[closure]);
-		
-		foreach(State s, closure) {
-			Q_ASSERT(s.id()>=0&&s.id()<states.size());
-			dMarks[sourceState.id()].unite(states[s.id()]);
+	for(int source(0); source<subsets.count(); source++) {
+		hits.clear();
+		const int *members(subsets.members(source));
+		const int nmembers(subsets.size(source));
+		for(int i(0); i<nmembers; i++) {
+			const int s(members[i]);
+			dMarks[source].unite(states[s]);
+			for(int e(rowStart[s]); e<rowStart[s+1]; e++) {
+				hits.append(QPair<int, int>(edgeRange[e], comp[edgeTarget[e]]));
+			}
 		}
+		qSort(hits);
 		
-		for(int r(0); r<nranges; r++) {
-			const QHash<State, State> & h=trans[r].second;
-			Closure dest;
-			foreach(State s, closure) {
-				QHash<State, State>::const_iterator it(h.find(s));
-				if(it!=h.end())dest.unite(closures[it.value().id()]);
+		int h(0);
+		while(h<hits.size()) {
+			const int r(hits[h].first);
+			generation++;
+			dest.clear();
+			for(; h<hits.size() && hits[h].first==r; h++) {
+				if(h && hits[h-1]==hits[h])continue;
+				const int c(hits[h].second);
+				for(int k(closureStart[c]); k<closureStart[c+1]; k++) {
+					const int x(closurePool[k]);
+					if(stamp[x]==generation)continue;
+					stamp[x]=generation;
+					dest.append(x);
+				}
 			}
-			//out<<"DST("<<r<<"):\t";
-/*			foreach(State s, dest) {
-				out<<s.id()<<" ";
-			}*/
-			//out<<"\n\n";
-			if(!dest.size())continue;
-			State destState;
-			QMap<Closure, State>::const_iterator it(newStates.find(dest));
-			if(it==newStates.end()) {
-				destState=State(newStates.size());
-				newStates[dest]=destState;
-				todo.append(dest);
+			qSort(dest);
+			const int target(subsets.insert(dest, added));
+			if(added) {
 				dMarks.append(QSet<Mark>());
-				Q_ASSERT(dMarks.size()==newStates.size());
-			} else {
-				destState=it.value();
+				dtable.insert(dtable.size(), nranges, -1);
 			}
-			dtrans[r].second[sourceState]=destState;
+			dtable[source*nranges+r]=target;
 		}
 	}
 	
-	//out.flush();
-	//qDebug("\n%s", buf.buffer().data());
-	
 	FA res;
 	res.states=dMarks;
-	res.trans=dtrans.toList();
+	res.dranges=dranges;
+	res.dtable=dtable;
+	res.dense=true;
 	res.startState=State(0);
 	return res;
 }
 
 FA FA::minimal()const {
+	return minimal(defaultMinimization);
+}
+
+FA FA::minimal(Minimization algorithm)const {
 	Q_ASSERT(isDeterministic());
 	if(!isDeterministic()) {
-		return deterministic().minimal();
+		return deterministic().minimal(algorithm);
+	}
+	if(!dense) {
+		FA fa(*this);
+		fa.makeDense();
+		return fa.minimal(algorithm);
 	}
 	const int nstates(states.size());
-	const int nranges(trans.size());
+	const int nranges(dranges.size());
+	const int *table(dtable.constData());
 	QVector<bool> reachable(nstates);
+	QVector<int> todo;
 	reachable[startState.id()]=true;
-	bool done(false);
-	while(!done) {
-		done=true;
-		for(int s=0; s<nstates; s++) {
-			const State st(State(s));
-			for(int r=0; r<nranges; r++) {
-				const QHash<State, State> & h=trans[r].second;
-				QHash<State, State>::const_iterator it(h.find(State(s)));
-				if(it==h.end())continue;
-				const State d(*it);
-				if(reachable[d.id()])continue;
-				reachable[d.id()]=true;
-				done=false;
-			}
+	todo.append(startState.id());
+	for(int i=0; i<todo.size(); i++) {
+		const int *row(table+todo[i]*nranges);
+		for(int r=0; r<nranges; r++) {
+			const int d(row[r]);
+			if(d<0 || reachable[d])continue;
+			reachable[d]=true;
+			todo.append(d);
 		}
 	}
+	
+	QVector<int> revStart(nstates+1, 0);
+	for(int i=0; i<nstates*nranges; i++) {
+		if(table[i]>=0)revStart[table[i]+1]++;
+	}
+	for(int s=0; s<nstates; s++)revStart[s+1]+=revStart[s];
+	QVector<int> revSource(revStart[nstates]);
+	QVector<int> cursor(revStart);
+	for(int i=0; i<nstates*nranges; i++) {
+		if(table[i]>=0)revSource[cursor[table[i]]++]=i/nranges;
+	}
 	QVector<bool> terminating(nstates);
-	for(int s=0; s<nstates; s++)terminating[s]=states[s].size();
-	done=false;
-	while(!done) {
-		done=true;
-		for(int r=0; r<nranges; r++) {
-			const QHash<State, State> & h=trans[r].second;
-			for(QHash<State, State>::const_iterator it(h.begin()); it!=h.end(); ++it) {
-				if(terminating[it.key().id()] || !terminating[it.value().id()])continue;
-				done=false;
-				terminating[it.key().id()]=true;
-			}
+	todo.clear();
+	for(int s=0; s<nstates; s++) {
+		if(!states[s].size())continue;
+		terminating[s]=true;
+		todo.append(s);
+	}
+	for(int i=0; i<todo.size(); i++) {
+		const int d(todo[i]);
+		for(int e(revStart[d]); e<revStart[d+1]; e++) {
+			const int s(revSource[e]);
+			if(terminating[s])continue;
+			terminating[s]=true;
+			todo.append(s);
 		}
 	}
 	
-	QMap<QSet<Mark>, int> marks2class;
-	QList<QSet<State> > classes;
+	QMap<QVector<int>, int> marks2class;
 	QVector<int> state2class(nstates, -1);
-	
 	for(int s=0; s<nstates; s++) {
 		if(reachable[s]&&terminating[s]) {
-			QMap<QSet<FA::State>, int>::const_iterator it(marks2class.find(states[s]));
-			if(!marks2class.contains(states[s])) {
-				marks2class[states[s]]=classes.size();
-				state2class[s]=classes.size();
-				classes.append(QSet<FA::State>());
-				classes.back().insert(State(s));
-			} else {
-				classes[it.value()].insert(State(s));
-				state2class[s]=it.value();
-			}
+			const QVector<int> key(sortedIds(states[s]));
+			QMap<QVector<int>, int>::const_iterator it(marks2class.find(key));
+			if(it==marks2class.end())it=marks2class.insert(key, marks2class.size());
+			state2class[s]=it.value();
 		}
 	}
-/*	{
-		QBuffer buf;
-		buf.open(QBuffer::WriteOnly);
-		QTextStream out(&buf);
-		out<<"CLASSES:\n";
-		for(int i=0; i<classes.size(); i++) {
-			out<<i<<":\t";
-			foreach(State s, classes[i]) {
-				out<<s.id()<<" ";
-			}
-			out<<"\n";
-		}
-		out.flush();
-		qDebug("%s", buf.buffer().data());
-	}*/
+	if(algorithm==Moore) {
+		refineMoore(table, nranges, state2class, marks2class.size());
+	} else {
+		refineHopcroft(table, nranges, state2class, marks2class.size());
+	}
 	
-	QList<QSet<State> > nclasses;
-	done=false;
-	while(!done) {
-		nclasses.clear();
-		for(QList<QSet<State> >::const_iterator it(classes.begin()); it!=classes.end(); ++it) {
-			const QSet<State> & cls=*it;
-			QMap<QVector<int>, QSet<State> > m;
-			foreach(State s, cls) {
-				QVector<int> v(nranges);
-				for(int r=0; r<nranges; r++) {
-					v[r]=trans[r].second.value(s).id();
-					if(v[r]>=0)v[r]=state2class[v[r]];
-				}
-				m[v].insert(s);
-			}
-			for(QMap<QVector<int>, QSet<State> >::const_iterator mit(m.begin()); mit!=m.end(); ++mit) {
-				nclasses.append(mit.value());
-			}
-		}
-		done=(classes.size()==nclasses.size());
-		classes=nclasses;
-/*		{
-			QBuffer buf;
-			buf.open(QBuffer::WriteOnly);
-			QTextStream out(&buf);
-			out<<"CLASSES:\n";
-			for(int i=0; i<classes.size(); i++) {
-				out<<i<<":\t";
-				foreach(State s, classes[i]) {
-					out<<s.id()<<" ";
-				}
-				out<<"\n";
-			}
-			out.flush();
-			qDebug("%s", buf.buffer().data());
-		}*/
-		state2class=QVector<int>(states.size(), -1);
-		for(int i=0; i<classes.size(); i++) {
-			const QSet<State> & cls=classes[i];
-			foreach(State s, cls) {
-				state2class[s.id()]=i;
+	//classes are numbered by their smallest state, so both algorithms give identical tables
+	QVector<int> renumber(nstates, -1);
+	QVector<int> reps;
+	for(int s=0; s<nstates; s++) {
+		const int c(state2class[s]);
+		if(c<0 || renumber[c]>=0)continue;
+		renumber[c]=reps.size();
+		reps.append(s);
+	}
+	for(int s=0; s<nstates; s++) {
+		if(state2class[s]>=0)state2class[s]=renumber[state2class[s]];
+	}
+	
+	FA res;
+	const int nclasses(reps.size());
+	for(int c=0; c<nclasses; c++) {
+		res.states.append(states[reps[c]]);
+	}
+	if(state2class[startState.id()]>=0)res.startState=State(state2class[startState.id()]);
+	res.dranges=dranges;
+	res.dtable=QVector<int>(nclasses*nranges, -1);
+	res.dense=true;
+	for(int c=0; c<nclasses; c++) {
+		const int *row(table+reps[c]*nranges);
+		for(int r=0; r<nranges; r++) {
+			if(row[r]>=0 && state2class[row[r]]>=0) {
+				res.dtable[c*nranges+r]=state2class[row[r]];
 			}
 		}
 	}
 	
+	res.compress();
+	return res;
+}
+
+void FA::setDefaultMinimization(Minimization algorithm) {
+	defaultMinimization=algorithm;
+}
+
+FA FA::intersection(const FA & fa1, const FA & fa2) {
+	return product(fa1, fa2, false);
+}
+
+FA FA::difference(const FA & fa1, const FA & fa2) {
+	return product(fa1, fa2, true);
+}
+
+//builds only the state pairs reachable from the start pair; for the difference the second
+//automaton may get stuck, which is represented by -1
+FA FA::product(const FA & fa1, const FA & fa2, bool difference) {
+	FA a(fa1.isDeterministic()?fa1:fa1.deterministic());
+	FA b(fa2.isDeterministic()?fa2:fa2.deterministic());
+	if(!a.count() || !a.startState.isValid())return FA();
+	if(!difference && (!b.count() || !b.startState.isValid()))return FA();
+	a.makeDense();
+	b.makeDense();
+	const int na(a.dranges.size());
+	const int nb(b.dranges.size());
+	
+	QVector<int> points;
+	for(int r=0; r<na; r++) {
+		points.append(a.dranges[r].from.id());
+		points.append(a.dranges[r].to.id());
+	}
+	for(int r=0; r<nb; r++) {
+		points.append(b.dranges[r].from.id());
+		points.append(b.dranges[r].to.id());
+	}
+	qSort(points);
+	QVector<Range> ranges;
+	QVector<int> col1;
+	QVector<int> col2;
+	int i1(0);
+	int i2(0);
+	for(int k=0; k+1<points.size(); k++) {
+		const int lo(points[k]);
+		if(lo==points[k+1])continue;
+		while(i1<na && a.dranges[i1].to.id()<=lo)i1++;
+		while(i2<nb && b.dranges[i2].to.id()<=lo)i2++;
+		const int c1(i1<na && a.dranges[i1].from.id()<=lo?i1:-1);
+		const int c2(i2<nb && b.dranges[i2].from.id()<=lo?i2:-1);
+		if(c1<0 || (!difference && c2<0))continue;
+		ranges.append(Range(Symbol(lo), Symbol(points[k+1])));
+		col1.append(c1);
+		col2.append(c2);
+	}
+	const int nr(ranges.size());
+	
 	FA res;
-	typedef QSet<State> EqClass;
-	foreach(const EqClass & cls, classes) {
-		if(cls.contains(startState))res.startState=State(res.states.size());
-		const State s(*(cls.begin()));
-		res.states.append(states[s.id()]);
-	}
-	for(int r=0; r<nranges; r++) {
-		QHash<State, State> h;
-		for(int s=0; s<classes.size(); s++) {
-			const State from(s);
-			const State e(*(classes[s].begin()));
-			const State org_to(trans[r].second.value(e));
-			if(org_to.isValid() && state2class[org_to.id()]>=0) {
-				const State to(state2class[org_to.id()]);
-				h[from]=to;
+	res.dense=true;
+	res.dranges=ranges;
+	QHash<quint64, int> ids;
+	QVector<int> first;
+	QVector<int> second;
+	first.append(a.startState.id());
+	second.append(b.startState.isValid()?b.startState.id():-1);
+	ids.insert(((quint64)(quint32)first[0]<<32)|(quint32)(second[0]+1), 0);
+	for(int i=0; i<first.size(); i++) {
+		const QSet<Mark> & m1=a.states[first[i]];
+		const bool accept2(second[i]>=0 && b.states[second[i]].size());
+		if(difference) {
+			res.states.append(m1.size() && !accept2?m1:QSet<Mark>());
+		} else {
+			res.states.append(m1.size() && accept2?QSet<Mark>(m1).unite(b.states[second[i]]):QSet<Mark>());
+		}
+		for(int k=0; k<nr; k++) {
+			const int x(a.dtable[first[i]*na+col1[k]]);
+			const int y(second[i]>=0 && col2[k]>=0?b.dtable[second[i]*nb+col2[k]]:-1);
+			if(x<0 || (!difference && y<0)) {
+				res.dtable.append(-1);
+				continue;
+			}
+			const quint64 key(((quint64)(quint32)x<<32)|(quint32)(y+1));
+			int id(ids.value(key, -1));
+			if(id<0) {
+				id=first.size();
+				ids.insert(key, id);
+				first.append(x);
+				second.append(y);
 			}
+			res.dtable.append(id);
 		}
-		res.trans.append(QPair<Range, QHash<State, State> >(trans[r].first, h));
 	}
-	
+	res.startState=State(0);
 	res.compress();
 	return res;
 }
 
 void FA::compress() {
+	if(dense) {
+		const int n(states.size());
+		const int nr(dranges.size());
+		QVector<int> kept;
+		QVector<Range> ranges;
+		for(int r=0; r<nr; r++) {
+			bool same(ranges.size() && ranges.last().to==dranges[r].from);
+			for(int s=0; same && s<n; s++) {
+				same=dtable[s*nr+kept.last()]==dtable[s*nr+r];
+			}
+			if(same) {
+				ranges.last().to=dranges[r].to;
+			} else {
+				kept.append(r);
+				ranges.append(dranges[r]);
+			}
+		}
+		if(kept.size()==nr)return;
+		const int nk(kept.size());
+		QVector<int> table(n*nk);
+		for(int s=0; s<n; s++) {
+			for(int k=0; k<nk; k++) {
+				table[s*nk+k]=dtable[s*nr+kept[k]];
+			}
+		}
+		dranges=ranges;
+		dtable=table;
+		return;
+	}
 	int i(0);
 	while(i<trans.size()-1) {
 		QPair<Range, QHash<State, State> > & p1=trans[i];
@@ -577,7 +1229,13 @@ bool FA::match(const QVector<Symbol> & input)const {
 	for(int i=0; i<n; i++) {
 		const int c(search(input[i]));
 		if(c%2)return false;
-		Q_ASSERT(c>=0&&(c/2)<trans.size());
+		Q_ASSERT(c>=0&&(c/2)<rangeCount());
+		if(dense) {
+			const int to(dtable[curState.id()*dranges.size()+c/2]);
+			if(to<0)return false;
+			curState=State(to);
+			continue;
+		}
 		const QHash<State, State> & h=trans[c/2].second;
 		QHash<State, State>::const_iterator it(h.find(curState));
 		if(it==h.end())return false;
@@ -592,9 +1250,9 @@ void FA::print()const {
 	buf.open(QBuffer::WriteOnly);
 	QTextStream out(&buf);
 	out<<"\n";
-	const int nr(trans.size());
+	const int nr(rangeCount());
 	for(int i=0; i<nr; i++) {
-		const Range & r=trans[i].first;
+		const Range r(range(i));
 		out<<r.from.id()<<"\t"<<r.to.id()<<"\t:"<<i<<"\n";
 		//qDebug("%d\t%d\t:%d", r.from.id(), r.to.id(), i);
 	}
@@ -605,9 +1263,10 @@ void FA::print()const {
 		const State st(s);
 		if(st==startState)out<<"*";
 		out<<s<<":\t";
+		const QVector<State> row(transitions(st));
 		for(int r=0; r<nr; r++) {
 			if(r)out<<"\t";
-			out<<trans[r].second.value(s, State()).id();
+			out<<row[r].id();
 		}
 		if(states[s].size()) {
 			out<<"\t[";
@@ -25,6 +25,7 @@
 #include <QSet>
 #include <QList>
 #include <QPair>
+#include <QVector>
 
 class FA {
 	public:
@@ -82,18 +83,58 @@ class FA {
 			bool operator == (const StatePair & p)const {return first==p.first && second==p.second;}
 			bool operator != (const StatePair & p)const {return first!=p.first || second!=p.second;}
 		};
+		enum Minimization {Hopcroft, Moore};
+		//collects states and edges in bulk, the alphabet is split only once in finalize()
+		class Builder {
+			private:
+				struct Edge {
+					State from;
+					Range on;
+					State to;
+					int next;//previous edge leaving the same state, -1 ends the chain
+					Edge() {}
+					Edge(State f, const Range & r, State t, int n):from(f), on(r), to(t), next(n) {}
+				};
+				QList<QSet<Mark> > states;
+				QVector<Edge> edges;
+				QVector<int> head;
+				QSet<StatePair> etrans;
+				QList<QList<State> > eouts;
+				State startState;
+			public:
+				State addState();
+				int count()const;
+				void addMark(State s, Mark m);
+				void setStart(State s);
+				State start()const;
+				void addTransition(State from, const Range & on, State to);
+				bool addETransition(State from, State to);
+				StatePair insert(const FA & fa, bool keepMarks=true);
+				FA finalize()const;
+				FA extract(const StatePair & p)const;
+		};
 	private:
 		//int nextState;
 		QList<QSet<Mark> > states;
 		QList<QPair<Range, QHash<State, State> > > trans;
+		//dense mode: sorted ranges and a state-major table, -1 means no transition
+		QVector<Range> dranges;
+		QVector<int> dtable;
+		bool dense;
 		State startState;
 		QSet<StatePair> etrans;
 		int search(Symbol s)const;
 		void compress();
+		QVector<int> splitDense(const QVector<Range> & ranges);
+		void adjacency(QVector<int> & rowStart, QVector<int> & edgeRange, QVector<int> & edgeTarget)const;
+		void epsilonClosures(QVector<int> & comp, QVector<int> & closureStart, QVector<int> & closurePool)const;
+		static FA product(const FA & fa1, const FA & fa2, bool difference);
 	public:
 		FA();
 		State addState();
 		int count()const;
+		bool isDense()const;
+		void makeDense();
 		void addMark(State s, Mark m);
 		QSet<Mark> marks(State s)const;
 		void removeAllMarks();
@@ -111,6 +152,10 @@ class FA {
 		
 		FA deterministic()const;
 		FA minimal()const;
+		FA minimal(Minimization algorithm)const;
+		static void setDefaultMinimization(Minimization algorithm);
+		static FA intersection(const FA & fa1, const FA & fa2);
+		static FA difference(const FA & fa1, const FA & fa2);
 		
 		bool match(const QVector<Symbol> & input)const;
 		
@@ -52,7 +52,7 @@ namespace {
 		if(msg.size())out<<msg<<"\n";
 		out<<"QPG v0.2\n";
 		out<<"Usage:\n";
-		out<<"\tqpg -h<headerfile> -o<sourcecodefile> <grammerfile>\n";
+		out<<"\tqpg [-mhopcroft|-mmoore] [-v] -h<headerfile> -o<sourcecodefile> <grammerfile>\n";
 	}
 	
 	bool generatePlayer() {
@@ -79,6 +79,105 @@ namespace {
 		return true;
 	}
 	
+	const char *licenseHeader=
+		"/****************************************************************************\n"
+		"** \n"
+		"** Copyright 2010 Alexander Krosch\n"
+		"** \n"
+		"** This file is part of QPG - the Q Parser Generator.\n"
+		"** \n"
+		"** QPG is free software: you can redistribute it and/or modify\n"
+		"** it under the terms of the GNU General Public License as published by\n"
+		"** the Free Software Foundation, either version 3 of the License, or\n"
+		"** (at your option) any later version.\n"
+		"** \n"
+		"** QPG is distributed in the hope that it will be useful,\n"
+		"** but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+		"** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+		"** GNU General Public License for more details.\n"
+		"** \n"
+		"** You should have received a copy of the GNU General Public License\n"
+		"** along with QPG.  If not, see <http://www.gnu.org/licenses/>.\n"
+		"** \n"
+		"****************************************************************************/\n";
+	
+	enum {Digit=1, Space=2, Word=4};
+	
+	//classifies the code points by their general category in UnicodeData.txt
+	bool readUnicodeData(const QString & name, QVector<char> & classes) {
+		QFile file(name);
+		if(!file.open(QFile::ReadOnly|QFile::Text)) {
+			qDebug("Could not read %s", name.toUtf8().data());
+			return false;
+		}
+		classes.fill(0, 0x110000);
+		int rangeStart(-1);
+		while(!file.atEnd()) {
+			const QStringList fields(QString(file.readLine()).split(';'));
+			if(fields.size()<3)continue;
+			bool ok;
+			const int ucs(fields.value(0).toInt(&ok, 16));
+			if(!ok || ucs<0 || ucs>=0x110000) {
+				qDebug("Invalid line in %s", name.toUtf8().data());
+				return false;
+			}
+			const QString category(fields.value(2));
+			char c(0);
+			if(category=="Nd")c|=Digit;
+			if(category=="Zs" || category=="Zl" || category=="Zp")c|=Space;
+			if(category.startsWith("L") || category.startsWith("N") || category.startsWith("M"))c|=Word;
+			//blocks like CJK ideographs are given by their first and last code point
+			if(fields.value(1).endsWith(", First>")) {
+				rangeStart=ucs;
+				continue;
+			}
+			const int from(fields.value(1).endsWith(", Last>")?rangeStart:ucs);
+			for(int i=from; i<=ucs; i++)classes[i]=c;
+		}
+		for(int i=9; i<=13; i++)classes[i]=classes.at(i)|Space;
+		classes['_']=classes.at('_')|Word;
+		return true;
+	}
+	
+	bool generateCharClasses(const QString & unicodeData) {
+		QVector<char> classes;
+		if(!readUnicodeData(unicodeData, classes))return false;
+		QFile file("CharClasses.cpp");
+		if(!file.open(QFile::WriteOnly|QFile::Text))return false;
+		QTextStream ostream(&file);
+		const char *names[6]={"digit", "nonDigit", "whitespace", "nonWhitespace", "wordChar", "nonWordChar"};
+		const char masks[3]={Digit, Space, Word};
+		int sizes[6];
+		ostream<<licenseHeader;
+		ostream<<"#include \"CharClasses.h\"\n\nnamespace {\n";
+		for(int cl=0; cl<6; cl++) {
+			ostream<<"\tconst CharClasses::Range "<<names[cl]<<"[]={";
+			int n(0);
+			bool m(false);
+			int blockStart(-1);
+			for(int i=1; i<=0x110000; i++) {
+				//odd classes are the complements of the even ones
+				const bool d(i<0xFFFE || (i>0xFFFF && i<0x110000)?((classes.at(i)&masks[cl/2])!=0)!=(cl%2!=0):false);
+				if(d==m)continue;
+				if(d) {
+					blockStart=i;
+				} else {
+					ostream<<(n%8?" ":"\n\t\t")<<QString("{0x%1, 0x%2},").arg(blockStart, 4, 16, QChar('0')).arg(i, 4, 16, QChar('0'));
+					n++;
+				}
+				m=d;
+			}
+			ostream<<"\n\t};\n";
+			sizes[cl]=n;
+		}
+		ostream<<"}\n\nconst CharClasses::Range * const CharClasses::ranges[6]={";
+		for(int cl=0; cl<6; cl++)ostream<<(cl?", ":"")<<names[cl];
+		ostream<<"};\nconst int CharClasses::sizes[6]={";
+		for(int cl=0; cl<6; cl++)ostream<<(cl?", ":"")<<sizes[cl];
+		ostream<<"};\n\n//EOF\n";
+		return true;
+	}
+	
 	bool generateParsersFromSource() {
 		{
 			Parser p;
@@ -143,6 +242,20 @@ int main(int argc, char **argv) {
 	QString header;
 	QString source;
 	QString grammer;
+	bool verbose(false);
+	for(int i(1); i<a.size(); i++) {
+		const QString arg(a.value(i));
+		if(!arg.startsWith("-m"))continue;
+		if(arg=="-mhopcroft") {
+			FA::setDefaultMinimization(FA::Hopcroft);
+		} else if(arg=="-mmoore") {
+			FA::setDefaultMinimization(FA::Moore);
+		} else {
+			printUsage(QString("Unrecognized option:%1").arg(arg));
+			return -1;
+		}
+		a.removeAt(i--);
+	}
 	for(int i(1); i<a.size(); i++) {
 		const QString arg(a.value(i));
 		if(arg=="-b2") {
@@ -159,6 +272,13 @@ int main(int argc, char **argv) {
 			}
 			if(!generateParsers())return -1;
 			return 0;
+		} else if(arg=="-b4") {
+			if(a.size()!=3) {
+				printUsage();
+				return -1;
+			}
+			if(!generateCharClasses(a.value(2)))return -1;
+			return 0;
 		} else if(arg=="-b3") {
 			if(a.size()!=2) {
 				printUsage();
@@ -196,6 +316,8 @@ int main(int argc, char **argv) {
 				}
 				source=a.value(i);
 			}
+		} else if(arg=="-v") {
+			verbose=true;
 		} else if(arg.startsWith("-")) {
 			printUsage(QString("Unrecognized option:%1").arg(arg));
 			return -1;
@@ -223,7 +345,12 @@ int main(int argc, char **argv) {
 		err<<"Parsing of file'"<<grammer<<"'failed:\n"<<p.lastError()<<"\n";
 		return -1;
 	}
-	if(!p.compile()) {
+	const bool res(p.compile());
+	if(verbose && p.statistics().length()) {
+		QTextStream out(stdout);
+		out<<p.statistics()<<"\n";
+	}
+	if(!res) {
 		err<<"Generation of parser failed:\n"<<p.lastError()<<"\n";
 		return -1;
 	}
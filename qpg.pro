@@ -7,8 +7,8 @@ CONFIG += debug
 
 
 # Input
-HEADERS += fa.h REParser.h Parser.h Parser_gen.h cfg.h pda.h Recorder.h Player.h utils.h
-SOURCES += main.cpp fa.cpp REParser.cpp Parser.cpp Parser_gen.cpp cfg.cpp pda.cpp Recorder.cpp Player.cpp utils.cpp
+HEADERS += fa.h REParser.h Parser.h Parser_gen.h cfg.h pda.h Recorder.h Player.h utils.h CharClasses.h
+SOURCES += main.cpp fa.cpp REParser.cpp Parser.cpp Parser_gen.cpp cfg.cpp pda.cpp Recorder.cpp Player.cpp utils.cpp CharClasses.cpp
 
 HEADERS += REParser_gen.h
 SOURCES += REParser_gen.cpp
@@ -83,8 +83,20 @@ namespace qpg {
 						c=(ushort)in.mid(right+1, 4).toInt(0, 16);
 						right+=4;
 						break;
+					case 'U':
+					{
+						const int u(in.mid(right+1, 8).toInt(0, 16));
+						right+=8;
+						if(u>0xFFFF) {
+							res+=QChar(QChar::highSurrogate(u));
+							c=QChar::lowSurrogate(u);
+						} else {
+							c=(ushort)u;
+						}
+						break;
+					}
 				}
-				res+=c;
+				res+=QChar(c);
 				left=right+1;
 			}
 			right++;